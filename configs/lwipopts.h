@@ -35,9 +35,11 @@
 #define LWIP_NETIF_LINK_CALLBACK    1
 #define LWIP_NETIF_HOSTNAME         1
 #define LWIP_NETCONN                0
-#define MEM_STATS                   0
+// Heap and pool counters feed the admission governor (ws_governor.h)
+#define LWIP_STATS                  1
+#define MEM_STATS                   1
 #define SYS_STATS                   0
-#define MEMP_STATS                  0
+#define MEMP_STATS                  1
 #define LINK_STATS                  0
 // #define ETH_PAD_SIZE                2
 #define LWIP_CHKSUM_ALGORITHM       3
@@ -50,13 +52,14 @@
 #define LWIP_DNS                    1
 #define LWIP_MDNS_RESPONDER         0
 #define LWIP_TCP_KEEPALIVE          1
+// One pbuf per outgoing frame: tcp_write() then always copies, even without
+// TCP_WRITE_FLAG_COPY, so everything sent (flash pages too) passes through MEM_SIZE
 #define LWIP_NETIF_TX_SINGLE_PBUF   1
 #define DHCP_DOES_ARP_CHECK         0
 #define LWIP_DHCP_DOES_ACD_CHECK    0
 
 #ifndef NDEBUG
 #define LWIP_DEBUG                  1
-#define LWIP_STATS                  1
 #define LWIP_STATS_DISPLAY          1
 #endif
 
@@ -1,47 +1,404 @@
 #!/usr/bin/env python3
 import argparse
+import gzip
+import hashlib
 import os
+import re
 
-def html_to_c_header(html_path: str, header_path: str = None):
+# Tipos MIME por extensão; o resto é servido como binário
+MIME_TYPES = {
+    ".html": "text/html; charset=UTF-8",
+    ".htm":  "text/html; charset=UTF-8",
+    ".css":  "text/css; charset=UTF-8",
+    ".js":   "text/javascript; charset=UTF-8",
+    ".json": "application/json",
+    ".svg":  "image/svg+xml",
+    ".txt":  "text/plain; charset=UTF-8",
+    ".png":  "image/png",
+    ".jpg":  "image/jpeg",
+    ".ico":  "image/x-icon",
+}
+
+# Já comprimidos: gzip não ajuda
+NO_GZIP = {".png", ".jpg", ".ico"}
+
+# ---------------------------------------------------------------------------
+# Minificação (conservadora: só remove o que não muda o resultado)
+# ---------------------------------------------------------------------------
+
+CSS_LITERAL = re.compile(r'(/\*.*?\*/)|("(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\')', re.S)
+
+def minify_css(css: str) -> str:
+    # Strings saem do caminho (e comentários somem) numa só passada, da
+    # esquerda para a direita: "/*" dentro de string não é comentário
+    strings = []
+    def keep(m):
+        if m.group(1):
+            return ' '
+        strings.append(m.group(2))
+        return f"\x00{len(strings) - 1}\x00"
+
+    css = CSS_LITERAL.sub(keep, css)
+    css = re.sub(r'\s+', ' ', css)                           # espaços repetidos
+    css = re.sub(r'\s*([{};,>])\s*', r'\1', css)             # espaços em volta de pontuação
+    css = re.sub(r':\s+', ':', css)                          # "a: b" -> "a:b" (antes do ':' pode ser seletor)
+    css = css.replace(';}', '}')
+    css = re.sub(r'\x00(\d+)\x00', lambda m: strings[int(m.group(1))], css)
+    return css.strip()
+
+# Depois destes, '/' começa uma expressão regular, não uma divisão
+JS_REGEX_AFTER = set('(,=:[!&|?{};+-*%<>~^')
+JS_REGEX_KEYWORDS = {'return', 'typeof', 'instanceof', 'in', 'of', 'new', 'delete', 'void', 'throw', 'case', 'do', 'else', 'yield', 'await'}
+
+def js_skip_quoted(js: str, i: int) -> int:
+    # Fim de uma string '...' ou "..." que começa em i
+    quote = js[i]
+    i += 1
+    while i < len(js) and js[i] != quote and js[i] != '\n':
+        i += 2 if js[i] == '\\' else 1
+    return i + 1
+
+def js_skip_regex(js: str, i: int) -> int:
+    # Fim de /.../flags; '/' dentro de [...] não fecha
+    i += 1
+    in_class = False
+    while i < len(js) and js[i] != '\n':
+        c = js[i]
+        if c == '\\':
+            i += 2
+            continue
+        if c == '[':
+            in_class = True
+        elif c == ']':
+            in_class = False
+        elif c == '/' and not in_class:
+            break
+        i += 1
+    i += 1
+    while i < len(js) and (js[i].isalnum() or js[i] == '_'):
+        i += 1
+    return i
+
+def js_skip_template(js: str, i: int) -> int:
+    # Fim de `...`, com ${...} (que pode ter strings e templates) dentro
+    i += 1
+    while i < len(js) and js[i] != '`':
+        if js[i] == '\\':
+            i += 2
+        elif js.startswith('${', i):
+            i = js_skip_code(js, i + 2, '}')
+        else:
+            i += 1
+    return i + 1
+
+def js_skip_code(js: str, i: int, close: str) -> int:
+    # Fim de um trecho de código terminado por `close` no mesmo nível
+    depth = 0
+    while i < len(js):
+        c = js[i]
+        if c in '\'"':
+            i = js_skip_quoted(js, i)
+        elif c == '`':
+            i = js_skip_template(js, i)
+        elif js.startswith('//', i) or js.startswith('/*', i):
+            end = js.find('\n' if js[i + 1] == '/' else '*/', i + 2)
+            i = len(js) if end < 0 else end + (0 if js[i + 1] == '/' else 2)
+        elif c == '{':
+            depth += 1
+            i += 1
+        elif c == '}' and depth > 0:
+            depth -= 1
+            i += 1
+        elif c == close:
+            return i + 1
+        else:
+            i += 1
+    return i
+
+def js_regex_allowed(code: str) -> bool:
+    # Decide se um '/' depois de `code` (o código já lido) abre uma regex
+    code = code.rstrip()
+    if not code:
+        return True
+    if code[-1] in JS_REGEX_AFTER:
+        return True
+    word = re.search(r'[A-Za-z_$][\w$]*$', code)
+    return bool(word) and word.group(0) in JS_REGEX_KEYWORDS
+
+def minify_js(js: str) -> str:
+    # Strings, templates e regexes saem do caminho e comentários somem numa
+    # só passada; depois cada linha perde a indentação. As quebras de linha
+    # ficam (inserção automática de ';')
+    literals = []
+    code = []
+    i = 0
+    while i < len(js):
+        c = js[i]
+        if js.startswith('//', i):
+            end = js.find('\n', i)
+            i = len(js) if end < 0 else end
+            continue
+        if js.startswith('/*', i):
+            end = js.find('*/', i + 2)
+            end = len(js) if end < 0 else end + 2
+            code.append('\n' if '\n' in js[i:end] else ' ')
+            i = end
+            continue
+        if c in '\'"`' or (c == '/' and js_regex_allowed(''.join(code[-64:]))):
+            end = (js_skip_template(js, i) if c == '`' else
+                   js_skip_quoted(js, i) if c != '/' else js_skip_regex(js, i))
+            literals.append(js[i:end])
+            code.append(f"\x00{len(literals) - 1}\x00")
+            i = end
+            continue
+        code.append(c)
+        i += 1
+
+    lines = (line.strip() for line in ''.join(code).splitlines())
+    js = '\n'.join(line for line in lines if line)
+    return re.sub(r'\x00(\d+)\x00', lambda m: literals[int(m.group(1))], js)
+
+RAW_BLOCK = re.compile(r'(<(script|style|pre|textarea)\b[^>]*>)(.*?)(</\2\s*>)', re.S | re.I)
+
+# Tags que não aparecem na página: o espaço em volta delas pode sumir. Entre
+# as outras ele vira um espaço só, pois separa elementos inline
+HTML_INVISIBLE = r'(?:!doctype|html|head|body|meta|title|link|base|style|script)\b'
+
+def minify_html(html: str) -> str:
+    # Blocos cujo conteúdo não é HTML saem do caminho antes de mexer nos
+    # espaços; o marcador guarda o nome da tag
+    blocks = []
+    def keep(m):
+        tag = m.group(2).lower()
+        inner = m.group(3)
+        if tag == 'style':
+            inner = minify_css(inner)
+        elif tag == 'script':
+            inner = minify_js(inner)
+        blocks.append(m.group(1) + inner + m.group(4))
+        return f"<{tag}\x00{len(blocks) - 1}\x00>"
+
+    html = RAW_BLOCK.sub(keep, html)
+    html = re.sub(r'<!--(?!\[if).*?-->', '', html, flags=re.S)    # comentários
+    html = re.sub(r'>\s+(?=</?' + HTML_INVISIBLE + ')', '>', html, flags=re.I)
+    html = re.sub(r'(</?' + HTML_INVISIBLE + r'[^>]*>)\s+', r'\1', html, flags=re.I)
+    html = re.sub(r'\s+', ' ', html)                                 # espaços repetidos
+    html = re.sub(r'<\w+\x00(\d+)\x00>', lambda m: blocks[int(m.group(1))], html)
+    return html.strip()
+
+def minify(data: bytes, ext: str) -> bytes:
+    if ext in (".html", ".htm"):
+        return minify_html(data.decode('utf-8')).encode('utf-8')
+    if ext == ".css":
+        return minify_css(data.decode('utf-8')).encode('utf-8')
+    if ext == ".js":
+        return minify_js(data.decode('utf-8')).encode('utf-8')
+    return data
+
+# ---------------------------------------------------------------------------
+# Geração dos headers
+# ---------------------------------------------------------------------------
+
+def gzip_bytes(data: bytes) -> bytes:
+    # mtime fixo: o mesmo HTML gera sempre o mesmo array
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+def etag(data: bytes) -> str:
+    # Validador forte: muda sempre que o conteúdo muda
+    return '"' + hashlib.sha1(data).hexdigest()[:16] + '"'
+
+def write_etag(out, name: str, data: bytes):
+    value = etag(data).replace('"', '\\"')
+    out.write(f"#define {name}_ETAG \"{value}\"\n")
+
+def write_c_array(out, name: str, data: bytes):
+    out.write(f"static const uint8_t {name}[] = {{\n")
+    for i in range(0, len(data), 16):
+        chunk = ", ".join(f"0x{b:02x}" for b in data[i:i + 16])
+        out.write(f"    {chunk},\n")
+    out.write("};\n")
+    out.write(f"#define {name}_LEN {len(data)}\n")
+
+def asset_names(asset_path: str):
+    # index.html -> INDEX, rota "/index"; style.css -> STYLE_CSS, rota "/style.css"
+    base, ext = os.path.splitext(os.path.basename(asset_path))
+    ext = ext.lower()
+    if ext in (".html", ".htm"):
+        prefix, route = base, "/" + base
+    else:
+        prefix, route = base + "_" + ext[1:], "/" + base + ext
+    prefix = re.sub(r'\W', '_', prefix).upper()
+    return prefix, route, ext
+
+def asset_to_c_header(asset_path: str, header_path: str = None, with_gzip: bool = True, with_minify: bool = True):
+    prefix, route, ext = asset_names(asset_path)
 
     # Define o nome do header de saída
     if header_path is None:
-        base = os.path.splitext(html_path)[0]
+        base = os.path.splitext(asset_path)[0] if ext in (".html", ".htm") else asset_path
         header_path = base + ".h"
 
-    base_name = os.path.basename(os.path.splitext(header_path)[0])
-    var_name = f"{base_name}_BODY"
-    guard    = base_name.upper().replace('.', '_') + "_H"
+    guard = os.path.basename(header_path).upper().replace('.', '_')
+    with open(asset_path, 'rb') as f:
+        raw = f.read()
 
-    # Lê e processa linha a linha
-    with open(html_path, 'r', encoding='utf-8') as f:
-        lines = f.readlines()
+    body = minify(raw, ext) if with_minify else raw
+    use_gzip = with_gzip and ext not in NO_GZIP
 
     # Gera o header
     with open(header_path, 'w', encoding='utf-8') as out:
         out.write(f"#ifndef {guard}\n")
         out.write(f"#define {guard}\n\n")
-        out.write(f"#define {var_name.upper()} \\ \n")
-
-        for i,line in enumerate(lines):
-            line = line.rstrip('\r\n')                     # remove \n ou \r\n
-            line = line.replace('\\', '\\\\')              # escapa barra invertida
-            line = line.replace('"', '\\"')                # escapa aspas duplas
-            bn = '\\'
-            out.write(f"    \"{line}\" {bn if i < len(lines) - 1 else ''}\n")                 # escreve a linha como literal
-        
+        out.write(f"// Gerado por htmltoh.py a partir de {os.path.basename(asset_path)}: não edite\n\n")
+        out.write("#include <stdint.h>\n\n")
+        out.write(f"#define {prefix}_MIME \"{MIME_TYPES.get(ext, 'application/octet-stream')}\"\n\n")
+
+        write_c_array(out, f"{prefix}_BODY", body)
+        write_etag(out, f"{prefix}_BODY", body)
         out.write("\n")
+
+        # Mesmo conteúdo, comprimido, para clientes que aceitam
+        # "Content-Encoding: gzip"
+        if use_gzip:
+            compressed = gzip_bytes(body)
+            write_c_array(out, f"{prefix}_BODY_GZ", compressed)
+            write_etag(out, f"{prefix}_BODY_GZ", compressed)
+            out.write("\n")
+
         out.write(f"#endif /* {guard} */\n")
 
-    print(f"✅ Header gerado: {header_path}")
+    sizes = f"{len(raw)} -> {len(body)}" + (f" -> gzip {len(compressed)}" if use_gzip else "")
+    print(f"✅ Header gerado: {header_path} ({sizes} bytes)")
+    return {"prefix": prefix, "route": route, "header": header_path, "gzip": use_gzip}
+
+# ---------------------------------------------------------------------------
+# Hash perfeito mínimo das rotas (PERFECT_HASH_SEARCH em src/http.c)
+# As funções abaixo repetem http_route_hash/mix/reduce de includes/http.h
+# ---------------------------------------------------------------------------
+
+MASK32 = 0xFFFFFFFF
+
+def route_hash(path: bytes, seed: int) -> int:
+    # FNV-1a de 32 bits
+    h = 2166136261 ^ seed
+    for b in path:
+        h = ((h ^ b) * 16777619) & MASK32
+    return h
+
+def route_mix(h: int) -> int:
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+def route_reduce(h: int, n: int) -> int:
+    # Mapeia h para [0, n) sem divisão (o M0+ não divide em hardware)
+    return (h * n) >> 32
+
+def perfect_hash(paths):
+    # Hash-and-displace (CHD): cada balde recebe um deslocamento que espalha
+    # suas chaves em posições livres. n chaves ocupam exatamente n posições.
+    n = len(paths)
+    buckets = max(1, (n + 1) // 2)
+    for seed in range(1000):
+        hashes = [route_hash(p.encode(), seed) for p in paths]
+        if len(set(hashes)) != n:
+            continue
+
+        members = [[] for _ in range(buckets)]
+        for i, h in enumerate(hashes):
+            members[route_reduce(h, buckets)].append(i)
+
+        displace = [0] * buckets
+        slots = [None] * n
+        ok = True
+        # Baldes maiores primeiro, enquanto a tabela está vazia
+        for b in sorted(range(buckets), key=lambda b: -len(members[b])):
+            if not members[b]:
+                continue
+            for d in range(1 << 16):
+                pos = [route_reduce(route_mix(hashes[i] ^ d), n) for i in members[b]]
+                if len(set(pos)) == len(pos) and all(slots[q] is None for q in pos):
+                    for i, q in zip(members[b], pos):
+                        slots[q] = i
+                    displace[b] = d
+                    break
+            else:
+                ok = False
+                break
+        if ok:
+            return seed, displace, slots
+    raise SystemExit("❌ Não foi possível gerar o hash perfeito das rotas")
+
+def write_manifest(manifest_path: str, assets):
+    # Tabela pronta para add_http_assets()/add_http_route_table(); index também responde em "/"
+    guard = os.path.basename(manifest_path).upper().replace('.', '_')
+    manifest_dir = os.path.dirname(os.path.abspath(manifest_path))
+
+    entries = []
+    paths = []
+    for a in assets:
+        routes = [a["route"]] + (["/"] if a["route"] == "/index" else [])
+        for route in routes:
+            p = a["prefix"]
+            gz = f"{p}_BODY_GZ, {p}_BODY_GZ_LEN" if a["gzip"] else "NULL, 0"
+            gz_etag = f"{p}_BODY_GZ_ETAG" if a["gzip"] else "NULL"
+            entries.append(f"    {{ \"{route}\", {p}_MIME, {p}_BODY, {p}_BODY_LEN, {gz}, {p}_BODY_ETAG, {gz_etag} }},\n")
+            paths.append(route)
+
+    if len(set(paths)) != len(paths):
+        raise SystemExit("❌ Rotas repetidas no manifesto")
+    seed, displace, slots = perfect_hash(paths)
+
+    with open(manifest_path, 'w', encoding='utf-8') as out:
+        out.write(f"#ifndef {guard}\n")
+        out.write(f"#define {guard}\n\n")
+        out.write("// Gerado por htmltoh.py: não edite\n\n")
+        out.write("#include \"http.h\"\n")
+        for a in assets:
+            out.write(f"#include \"{os.path.relpath(os.path.abspath(a['header']), manifest_dir)}\"\n")
+        out.write("\nstatic const http_asset_t http_assets[] = {\n")
+        out.writelines(entries)
+        out.write("};\n")
+        out.write("#define HTTP_ASSETS_COUNT (sizeof(http_assets) / sizeof(http_assets[0]))\n\n")
+
+        # Tabela de rotas em flash: um hash e uma comparação por busca
+        out.write("static const uint16_t http_route_displace[] = {")
+        out.write(", ".join(str(d) for d in displace))
+        out.write("};\n\n")
+        out.write("static const http_route_slot_t http_route_slots[] = {\n")
+        for i in slots:
+            out.write(f"    {{ \"{paths[i]}\", {len(paths[i].encode())}, {i} }},\n")
+        out.write("};\n\n")
+        out.write("static const http_route_table_t http_route_table = {\n")
+        out.write("    .assets = http_assets,\n")
+        out.write("    .count = HTTP_ASSETS_COUNT,\n")
+        out.write("    .displace = http_route_displace,\n")
+        out.write("    .slots = http_route_slots,\n")
+        out.write(f"    .buckets = {len(displace)},\n")
+        out.write(f"    .seed = {seed}u,\n")
+        out.write("};\n\n")
+        out.write(f"#endif /* {guard} */\n")
+
+    print(f"✅ Manifesto gerado: {manifest_path}")
 
 def main():
-    parser = argparse.ArgumentParser(description="Converte HTML em header C.")
-    parser.add_argument("html_file", help="arquivo .html de entrada")
-    parser.add_argument("-o", "--output", help="arquivo .h de saída")
+    parser = argparse.ArgumentParser(description="Converte páginas (HTML/CSS/JS...) em headers C.")
+    parser.add_argument("files", nargs="+", help="arquivos de entrada")
+    parser.add_argument("-o", "--output", help="arquivo .h de saída (com um único arquivo de entrada)")
+    parser.add_argument("-m", "--manifest", help="gera também a tabela de rotas (http_asset_t) neste arquivo")
+    parser.add_argument("--no-gzip", action="store_true", help="não gera o array comprimido (_GZ)")
+    parser.add_argument("--no-minify", action="store_true", help="embute o arquivo sem minificar")
     args = parser.parse_args()
 
-    html_to_c_header(args.html_file, args.output)
+    if args.output and len(args.files) > 1:
+        parser.error("-o só pode ser usado com um arquivo de entrada")
+
+    assets = [asset_to_c_header(f, args.output, not args.no_gzip, not args.no_minify) for f in args.files]
+    if args.manifest:
+        write_manifest(args.manifest, assets)
 
 if __name__ == "__main__":
     main()
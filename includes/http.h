@@ -5,25 +5,142 @@
 #include <string.h>
 #include "pico/stdlib.h"
 #include "lwip/tcp.h"
+#include "http_router.h"
+#include "http_query.h"
 
 extern char dnss_captive_site[64];
 #define KB(v) (v*1024U)
 
 #define HTTP_RESPONSE_BUFFER_SIZE KB(4)
 #define PAYLOAD_TEMP_BUFFER_SIZE  KB(4)
+#define HTTP_MAX_NEW_SCHEMAS      4
+#define HTTP_NEW_SCHEMA_MAX_LEN   48
+#define HTTP_MAX_CONNECTIONS      4   // beyond this the longest idle one is evicted
 
+// Captive-portal probes (/generate_204, /hotspot-detect.html...):
+// HTTP_CAPTIVE_REDIRECT sends the device to http://dnss_captive_site/, so it
+// opens the portal; HTTP_CAPTIVE_ONLINE gives each OS the answer it expects
+// from the internet, so it stays on the network without prompting
+typedef enum {
+    HTTP_CAPTIVE_REDIRECT,
+    HTTP_CAPTIVE_ONLINE
+} HTTP_CAPTIVE_POLICY;
+#ifndef HTTP_CAPTIVE_DEFAULT_POLICY
+#define HTTP_CAPTIVE_DEFAULT_POLICY HTTP_CAPTIVE_REDIRECT
+#endif
+
+// Persistent connections
+#define HTTP_KEEPALIVE_TIMEOUT_S          5
+#define HTTP_HEADER_TIMEOUT_S             3   // whole request head, however slowly it arrives
+#define HTTP_MAX_REQUESTS_PER_CONNECTION  16
+#define HTTP_POLL_INTERVAL                2   // tcp_poll units of 500 ms
+
+// Constant responses
+#ifndef HTTP_MAX_STATIC_ROUTES
+#define HTTP_MAX_STATIC_ROUTES    8
+#endif
+#define HTTP_STATIC_HEADER_SIZE   160
+#define HTTP_STATIC_LENGTH_SIZE   80
+
+// Response writers: head and first body bytes are staged here, so a response
+// that fits gets a Content-Length and a larger one goes out chunked
+#define HTTP_WRITER_BUFFER_SIZE   1024
+#define HTTP_MAX_WRITERS          2
+
+// Routes with ":param" or "*" segments, kept in a radix tree (http_router.h)
+#ifndef HTTP_MAX_PATTERN_ROUTES
+#define HTTP_MAX_PATTERN_ROUTES   16
+#endif
+
+// Streamed bodies: lwIP copies whatever is sent into its heap, generated or
+// flash data alike, so only HTTP_STREAM_COPY_WINDOW bytes of a body are kept
+// in flight
+#define HTTP_STREAM_CHUNK_SIZE    512
+#define HTTP_STREAM_COPY_WINDOW   (2 * TCP_MSS)
+
+// `query_parameters` is the raw query string ("" if none) in the request
+// buffer; read it in place with http_query_find()/http_query_next()
 typedef void(*route_response_handler_t)(char* query_parameters, char* http_response_buffer, size_t http_response_len);
+// Same, with the segments captured by the route pattern (see http_route_param)
+typedef void(*route_param_handler_t)(const http_route_params_t* params, char* query_parameters, char* http_response_buffer, size_t http_response_len);
+// Writes up to `len` bytes of the body starting at `offset` into `buffer` and
+// returns how many were written (0 aborts the response). The same offset may
+// be asked for again if lwIP ran out of memory.
+typedef size_t(*http_body_generator_t)(size_t offset, char* buffer, size_t len, void* arg);
+// Same for a body whose length is not known in advance, sent with
+// Transfer-Encoding: chunked: `len` follows the free send buffer, and
+// returning 0 ends the body.
+typedef size_t(*http_chunk_producer_t)(size_t offset, char* buffer, size_t len, void* arg);
+// Request bodies (POST/PUT), handed to the route as they arrive. `content_length`
+// is HTTP_BODY_CHUNKED for a chunked body. Returning false from begin answers
+// 413 and closes; `ctx` is passed to the other callbacks.
+#define HTTP_BODY_CHUNKED SIZE_MAX
+typedef bool(*http_body_begin_t)(struct tcp_pcb* tpcb, const char* method, const http_route_params_t* params,
+                                 char* query_parameters, size_t content_length, void** ctx);
+// Next piece of the body, valid only during the call. Returns how many bytes
+// were taken: fewer than `len` pauses the upload, which the TCP window then
+// holds back until http_body_resume() (or the next poll) offers the rest.
+// A negative value rejects the body with 400.
+typedef int(*http_body_data_t)(void* ctx, const uint8_t* data, size_t len);
+// Whole body received: writes the response like a route_response_handler_t
+typedef void(*http_body_end_t)(void* ctx, char* http_response_buffer, size_t http_response_len);
+// Connection lost or body rejected before the end (optional)
+typedef void(*http_body_abort_t)(void* ctx);
+
+typedef struct {
+    http_body_begin_t on_begin;
+    http_body_data_t on_data;
+    http_body_end_t on_end;
+    http_body_abort_t on_abort;
+} http_body_handler_t;
+
+// Response written piece by piece, in constant RAM. A handler may return
+// before http_end(): the writer stays valid, and the drain callback (if set)
+// is called whenever the send buffer frees up, until http_end(). If the
+// connection is lost first it is called once more with `writer` NULL.
+typedef struct http_writer http_writer_t;
+typedef void(*route_writer_handler_t)(http_writer_t* writer, const http_route_params_t* params, char* query_parameters);
+typedef void(*http_writer_drain_t)(http_writer_t* writer, void* arg);
+
 typedef err_t(*new_schema_handler_t)(char* payload_buffer,struct tcp_pcb *tpcb, struct pbuf *p);
 
+// Response fixed at registration: the header lines are built once and the
+// body stays where it lives, usually in flash, so nothing is formatted per
+// request. lwIP still copies what is sent into its heap (see
+// LWIP_NETIF_TX_SINGLE_PBUF), so bodies are streamed a window at a time as
+// acknowledgements arrive, from `body`, `gzip_body` or `generator`.
+typedef struct {
+    const char* body;
+    size_t body_len;
+    const uint8_t* gzip_body;   // precompressed variant, NULL if none
+    size_t gzip_len;
+    const char* etag;           // validators (quoted), NULL if not cacheable
+    const char* gzip_etag;
+    http_body_generator_t generator;
+    void* generator_arg;
+    uint16_t header_len;
+    uint8_t length_len;
+    uint8_t gzip_length_len;
+    char header[HTTP_STATIC_HEADER_SIZE];           // status line to Cache-Control
+    char length[HTTP_STATIC_LENGTH_SIZE];           // ETag and framing of `body`
+    char gzip_length[HTTP_STATIC_LENGTH_SIZE];      // ETag and framing of `gzip_body`
+} http_static_response_t;
+
 typedef struct {
     const char* route_path;
     size_t route_path_len;
     route_response_handler_t route_response_handler;
+    const http_static_response_t* static_response;
+    route_param_handler_t route_param_handler;
+    route_writer_handler_t route_writer_handler;
 } http_route_t;
 
 typedef struct {
     size_t route_path_len;
     route_response_handler_t route_response_handler;
+    const http_static_response_t* static_response;
+    route_param_handler_t route_param_handler;
+    route_writer_handler_t route_writer_handler;
 } http_route_item_t;
 
 typedef struct {
@@ -32,7 +149,7 @@ typedef struct {
 } http_routes_hashmap_t;
 
 typedef struct {
-    const char* new_schema;
+    char new_schema[HTTP_NEW_SCHEMA_MAX_LEN];
     new_schema_handler_t new_schema_handler;
 } new_schema_route_t;
 
@@ -48,17 +165,157 @@ typedef struct {
 } http_routes_t;
 
 typedef struct {
-    new_schema_route_t *items;
+    new_schema_route_t items[HTTP_MAX_NEW_SCHEMAS];
     size_t count;
-    size_t capacity;
 } new_schemas_routes_t;
 
+typedef struct {
+    http_static_response_t items[HTTP_MAX_STATIC_ROUTES];
+    size_t count;
+} http_static_routes_t;
+
+typedef struct {
+    http_route_item_t items[HTTP_MAX_PATTERN_ROUTES];
+    size_t count;
+} http_pattern_routes_t;
+
+// One entry of the manifest written by htmltoh.py (routes/assets.h)
+typedef struct {
+    const char* route_path;
+    const char* content_type;
+    const uint8_t* body;
+    size_t body_len;
+    const uint8_t* gzip_body;   // NULL when generated with --no-gzip
+    size_t gzip_len;
+    const char* etag;
+    const char* gzip_etag;
+} http_asset_t;
+
+// Route table generated by htmltoh.py with a minimal perfect hash over the
+// manifest paths: every path owns one slot, found with one hash and checked
+// with one compare (see PERFECT_HASH_SEARCH in http.c)
+typedef struct {
+    const char* route_path;
+    uint16_t route_path_len;
+    uint16_t asset;             // index in the manifest
+} http_route_slot_t;
+
+typedef struct {
+    const http_asset_t* assets;
+    size_t count;               // manifest entries, also the number of slots
+    const uint16_t* displace;   // one per bucket
+    const http_route_slot_t* slots;
+    uint16_t buckets;
+    uint32_t seed;
+} http_route_table_t;
+
+// htmltoh.py computes the same functions when it builds the table
+static inline uint32_t http_route_hash(const char* path, size_t len, uint32_t seed){
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (uint8_t)path[i]) * 16777619u;
+    }
+    return h;
+}
+
+static inline uint32_t http_route_mix(uint32_t h){
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// h scaled to [0, n) without a division
+static inline uint32_t http_route_reduce(uint32_t h, uint32_t n){
+    return (uint32_t)(((uint64_t)h * n) >> 32);
+}
+
 void start_http_server(void);
+// Every add_http_*route function accepts patterns besides exact paths:
+// "/api/sensor/:id" matches one segment, "/static/*" (or "/static/*file") the
+// rest of the path. Exact routes are looked up first, then the patterns.
 void add_http_route(const char* route_path, route_response_handler_t route_response_handler);
+// Handler receiving the captured segments as slices of the request path
+void add_http_param_route(const char* route_path, route_param_handler_t route_param_handler);
+// `body` must stay valid forever (a string literal or const array): it is read
+// from where it lives. For string literals use HTTP_STATIC_BODY("...").
+void add_http_static_route(const char* route_path, const char* content_type, const char* body, size_t body_len);
+// Same, with a gzip-compressed copy of the body (see htmltoh.py) served to
+// clients whose Accept-Encoding allows it. With `body` NULL only the gzip copy
+// is kept in flash and it is served to every client.
+// With ETags (computed by htmltoh.py from each variant) the page may be cached
+// by the browser, which revalidates it with If-None-Match and gets a 304
+// without the body while it is unchanged. Pass NULL to forbid caching.
+// HTTP_STATIC_ASSET(INDEX) expands to every argument after the content type.
+void add_http_static_route_gz(const char* route_path, const char* content_type, const char* body, size_t body_len,
+                              const uint8_t* gzip_body, size_t gzip_len, const char* etag, const char* gzip_etag);
+// Body of known length produced on demand, `len` bytes at a time, while it is
+// being sent: only HTTP_STREAM_COPY_WINDOW bytes of it exist in RAM at once
+void add_http_generator_route(const char* route_path, const char* content_type, size_t body_len, http_body_generator_t generator, void* arg);
+// Body of unknown length (logs, metrics) produced the same way, in chunks
+// sized to what the send buffer takes as it drains
+void add_http_chunked_route(const char* route_path, const char* content_type, http_chunk_producer_t producer, void* arg);
+// Handler given a writer instead of a fixed buffer
+void add_http_writer_route(const char* route_path, route_writer_handler_t route_writer_handler);
+
+// Status ("404 Not Found", default "200 OK") and headers: before any body.
+// Content-Type defaults to HTML and Cache-Control to no-store.
+void http_writer_status(http_writer_t* writer, const char* status);
+bool http_writer_header(http_writer_t* writer, const char* name, const char* value);
+// Copies body bytes; returns how many were taken (fewer when the send buffer
+// is full: write the rest from the drain callback)
+size_t http_write(http_writer_t* writer, const void* data, size_t len);
+bool http_printf(http_writer_t* writer, const char* format, ...);
+// Body bytes written from where they are (flash), skipping the staging
+// buffer. Keep them valid until acknowledged: lwIP copies them in this
+// configuration but would reference them without LWIP_NETIF_TX_SINGLE_PBUF.
+// Needs tcp_sndbuf() room for all of them.
+bool http_write_static(http_writer_t* writer, const void* data, size_t len);
+// Finishes the response: with Content-Length if nothing was sent yet
+void http_end(http_writer_t* writer);
+// About how many bytes http_write() takes right now
+size_t http_writer_space(http_writer_t* writer);
+void http_writer_on_drain(http_writer_t* writer, http_writer_drain_t drain, void* arg);
+
+// The writer functions call into lwIP. The handler and the drain callback
+// already run under the lwIP lock; anywhere else (main loop, timers, core1)
+// wrap the calls in cyw43_arch_lwip_begin() and cyw43_arch_lwip_end().
+// Once its response ends or its connection drops a writer is reused for
+// another response, so a raw pointer kept past the handler can go stale:
+// keep a reference instead, http_writer_get() returns NULL once it is.
+typedef struct {
+    http_writer_t* writer;
+    uint32_t generation;
+} http_writer_ref_t;
+http_writer_ref_t http_writer_ref(http_writer_t* writer);
+http_writer_t* http_writer_get(http_writer_ref_t ref);
+
+// POST and PUT to `route_path` (patterns allowed) go to `handler`, which must
+// stay valid. The body is never buffered whole: it is read as the handler
+// consumes it, and only what it consumed is acknowledged to the client.
+void add_http_body_route(const char* route_path, const http_body_handler_t* handler);
+// Continues a body paused by http_body_data_t; call it in lwIP context
+void http_body_resume(struct tcp_pcb* tpcb);
+// Registers every page of the manifest, e.g. add_http_assets(http_assets, HTTP_ASSETS_COUNT)
+void add_http_assets(const http_asset_t* assets, size_t count);
+// Registers the whole generated table. With PERFECT_HASH_SEARCH it is looked
+// up in place (no heap, nothing built at boot besides the response headers)
+// and other routes go to the radix tree; otherwise it is the same as
+// add_http_assets(table->assets, table->count).
+void add_http_route_table(const http_route_table_t* table);
 void add_new_schema_route(const char* new_schema, new_schema_handler_t new_schema_handler);
+// Switches the answer to captive-portal probes, e.g. to "online" once the
+// user has gone through the portal
+void http_set_captive_policy(HTTP_CAPTIVE_POLICY policy);
 
 #define LB(str) str"\r\n"
 
+#define HTTP_STATIC_BODY(body) body, (sizeof(body) - 1)
+#define HTTP_STATIC_ASSET(name) \
+        (const char*)name##_BODY, name##_BODY_LEN, name##_BODY_GZ, name##_BODY_GZ_LEN, name##_BODY_ETAG, name##_BODY_GZ_ETAG
+
 
 #define DNS_CAPTIVE_RESPONSE_HEADER \
         LB("HTTP/1.1 302 Found") \
@@ -72,7 +329,6 @@ void add_new_schema_route(const char* new_schema, new_schema_handler_t new_schem
         LB("HTTP/1.1 200 OK") \
         LB("Content-Type: text/html; charset=UTF-8") \
         LB("Cache-Control: no-cache, no-store, must-revalidate") \
-        LB("Connection: close") \
         LB("") \
 
 #endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef HTTP_PARSER_H
+
+#define HTTP_PARSER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "lwip/pbuf.h"
+
+// Method, target and the values of the headers below, NUL-terminated
+#define HTTP_PARSER_BUFFER_SIZE 512
+#define HTTP_PARSER_NAME_MAX    24
+#define HTTP_METHOD_MAX         8
+
+// Headers the server acts on; every other header is skipped without being stored
+typedef enum {
+    HTTP_HDR_HOST,
+    HTTP_HDR_CONNECTION,
+    HTTP_HDR_UPGRADE,
+    HTTP_HDR_SEC_WEBSOCKET_KEY,
+    HTTP_HDR_CONTENT_LENGTH,
+    HTTP_HDR_TRANSFER_ENCODING,
+    HTTP_HDR_ACCEPT_ENCODING,
+    HTTP_HDR_IF_NONE_MATCH,
+    HTTP_HDR_EXPECT,
+    HTTP_HDR_COUNT
+} HTTP_HEADER_ID;
+
+typedef enum {
+    HTTP_PARSE_INCOMPLETE,
+    HTTP_PARSE_COMPLETE,
+    HTTP_PARSE_INVALID,
+    HTTP_PARSE_URI_TOO_LONG,
+    HTTP_PARSE_HEADERS_TOO_LARGE
+} HTTP_PARSE_RESULT;
+
+// Incremental request-head parser. Fed byte ranges as they arrive, it keeps
+// its position across calls, so a request may be split anywhere.
+typedef struct {
+    uint8_t  state;
+    uint8_t  result;
+    uint8_t  version;                   // 10 for HTTP/1.0, 11 for HTTP/1.1
+    uint8_t  name_len;
+    int8_t   header_id;                 // header whose value is being stored, -1 if skipped
+    uint16_t len;                       // bytes of buf in use
+    uint16_t target;                    // offset of the path
+    uint16_t query;                     // offset of the query string ("" if none)
+    uint16_t version_at;
+    uint16_t value_start;
+    uint16_t value_end;
+    uint16_t headers[HTTP_HDR_COUNT];   // value offsets, 0 if absent
+    char     name[HTTP_PARSER_NAME_MAX];
+    char     buf[HTTP_PARSER_BUFFER_SIZE];
+} http_parser_t;
+
+void http_parser_reset(http_parser_t* hp);
+
+// Consumes bytes up to the end of the request head. `consumed` tells how much
+// of `data` was used: anything after it belongs to the body or the next request.
+// A head whose body framing is ambiguous (Content-Length repeated with another
+// value, or alongside Transfer-Encoding) is HTTP_PARSE_INVALID.
+HTTP_PARSE_RESULT http_parser_feed(http_parser_t* hp, const char* data, size_t len, size_t* consumed);
+
+// Same, walking a pbuf chain from `offset`
+HTTP_PARSE_RESULT http_parser_feed_pbuf(http_parser_t* hp, struct pbuf* p, uint16_t offset, uint16_t* consumed);
+
+char* http_parser_method(http_parser_t* hp);
+char* http_parser_path(http_parser_t* hp);
+char* http_parser_query(http_parser_t* hp);
+
+// Value of a tracked header, NULL if the request did not carry it
+char* http_parser_header(http_parser_t* hp, HTTP_HEADER_ID id);
+
+// Whether a comma-separated header (Connection, Accept-Encoding...) lists
+// `token`, ignoring case and parameters such as ";q=0.5"
+bool http_parser_header_has_token(http_parser_t* hp, HTTP_HEADER_ID id, const char* token);
+
+// Body framing (Content-Length or chunked). It does not copy: it walks the
+// framing bytes and points out where the body bytes are, and the caller tells
+// it how many of them it actually took.
+typedef enum {
+    HTTP_BODY_NEED_MORE,    // every byte given was framing
+    HTTP_BODY_DATA,         // body bytes follow the framing
+    HTTP_BODY_DONE,
+    HTTP_BODY_INVALID
+} HTTP_BODY_RESULT;
+
+typedef struct {
+    uint8_t state;
+    bool    digits;         // chunk size has a digit: inside a chunk, the body is chunked
+    size_t  remaining;      // body bytes left (in the current chunk when chunked)
+} http_body_parser_t;
+
+void http_body_parser_init(http_body_parser_t* bp, bool chunked, size_t content_length);
+
+// Skips the framing at the start of `data` (`framing` bytes) and, with
+// HTTP_BODY_DATA, sets `body_len` to the body bytes right after it
+HTTP_BODY_RESULT http_body_parser_next(http_body_parser_t* bp, const char* data, size_t len, size_t* framing, size_t* body_len);
+
+// Marks `n` of the body bytes last reported as consumed
+void http_body_parser_consume(http_body_parser_t* bp, size_t n);
+
+// Content-Length value, false if it is not a plain decimal number
+bool http_parse_content_length(const char* value, size_t* length);
+
+#endif
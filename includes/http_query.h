@@ -0,0 +1,45 @@
+#ifndef HTTP_QUERY_H
+
+#define HTTP_QUERY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// One "key=value" pair of a query string. Both slices point into the request
+// buffer as received, still percent-encoded, and are not NUL-terminated: they
+// are only decoded by the accessors below, when asked for.
+typedef struct {
+    const char* key;
+    const char* value;      // empty (not NULL) for a bare "key"
+    uint16_t key_len;
+    uint16_t value_len;
+} http_query_param_t;
+
+// Iterator over a query string, e.g. the `query_parameters` of a handler.
+// Valid as long as the string is: until the handler returns.
+typedef struct {
+    const char* query;
+    size_t len;
+    size_t pos;
+} http_query_t;
+
+void http_query_init(http_query_t* q, const char* query);
+
+// Next pair in order, false at the end. Empty pairs ("a=1&&b=2") are skipped.
+bool http_query_next(http_query_t* q, http_query_param_t* param);
+
+// First pair whose decoded key is `key`, compared without copying
+bool http_query_find(const char* query, const char* key, http_query_param_t* param);
+
+// Percent-decodes (and turns '+' into a space) into `dst`, always
+// NUL-terminated and truncated to `dst_size`. Returns the decoded length.
+size_t http_query_decode(const char* src, size_t len, char* dst, size_t dst_size);
+
+// Decoded comparison of a value, without copying
+bool http_query_value_equals(const http_query_param_t* param, const char* text);
+
+// Decimal value, false if it is empty, not a number or out of range
+bool http_query_value_long(const http_query_param_t* param, long* out);
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef HTTP_ROUTER_H
+
+#define HTTP_ROUTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef HTTP_ROUTER_MAX_NODES
+#define HTTP_ROUTER_MAX_NODES   48
+#endif
+#define HTTP_ROUTE_MAX_PARAMS   4
+
+// Segment captured by ":name" or "*name" (bare "*" is named "*"). Both slices
+// point into memory the router does not own: the name into the registered
+// pattern, the value into the request path. Neither is NUL-terminated.
+typedef struct {
+    const char* name;
+    const char* value;
+    uint8_t  name_len;
+    uint16_t value_len;
+} http_route_param_t;
+
+typedef struct {
+    http_route_param_t items[HTTP_ROUTE_MAX_PARAMS];
+    uint8_t count;
+} http_route_params_t;
+
+// Node of the radix tree. Static children share their common prefixes; a node
+// has at most one ":param" and one "*" child. Links are indices into the
+// router's node table, 0 meaning none (node 0 is the root).
+typedef struct {
+    const char* prefix;     // static text, or the name of a ":param"/"*" node
+    uint16_t prefix_len;
+    uint8_t  child;         // first static child
+    uint8_t  sibling;       // next static child of the same parent
+    uint8_t  param;
+    uint8_t  wildcard;
+    const void* value;      // route ending here, NULL if none
+} http_router_node_t;
+
+typedef struct {
+    http_router_node_t nodes[HTTP_ROUTER_MAX_NODES];
+    uint8_t count;
+} http_router_t;
+
+void http_router_init(http_router_t* router);
+
+// Adds a pattern made of static text, ":name" segments (one non-empty path
+// segment) and a final "*" or "*name" (the rest of the path, possibly empty).
+// The pattern is referenced, not copied: it must stay valid (a literal).
+// Fails when the table is full, the pattern is malformed, or it clashes with
+// a route already registered.
+bool http_router_add(http_router_t* router, const char* pattern, const void* value);
+
+// Value of the route matching `path`, NULL if none. Static text wins over a
+// parameter, which wins over a wildcard. Runs in O(path length) for routes
+// without overlapping parameters; `params` receives the captures.
+const void* http_router_match(const http_router_t* router, const char* path, size_t len, http_route_params_t* params);
+
+// Value captured for `name`, NULL if the route has no such parameter
+const char* http_route_param(const http_route_params_t* params, const char* name, size_t* len);
+
+// Whether `route_path` uses ":param" or "*" segments
+bool http_router_is_pattern(const char* route_path);
+
+#endif
@@ -4,10 +4,11 @@
 #include "ap.h"
 #include "http.h"
 #include "websocket.h"
+#include "ws_loop.h"
+#include "ws_state.h"
+#include "ws_timer.h"
 
-#include "routes/index.h"
-#include "routes/status.h"
-#include "routes/mouse.h"
+#include "routes/assets.h"
 
 char temp_buffer[512];
 #define LED_PIN 11
@@ -21,20 +22,6 @@ void reverse_msg(char *str, size_t len) {
     }
 }
 
-// ROTAS HTTP
-
-void create_index_response(char* query_params, char* buffer, size_t len) {
-    snprintf(buffer, len, HTTP_HEADER INDEX_BODY);
-}
-
-void create_status_response(char* query_params, char* buffer, size_t len) {
-    snprintf(buffer, len, HTTP_HEADER STATUS_BODY);
-}
-
-void create_mouse_response(char* query_params, char* buffer, size_t len) {
-    snprintf(buffer, len, HTTP_HEADER MOUSE_BODY);
-}
-
 // HANDLERS DE WEBSOCKET
 
 void on_text(ws_client_tpcb client, uint8_t* msg, size_t len) {
@@ -74,6 +61,15 @@ void on_close(ws_client_tpcb client, uint8_t* msg, size_t len) {
     printf("CLIENTE DESCONECTADO | IP %s\n", temp_buffer);
 }
 
+// Estado de "/status": quem conecta recebe tudo, depois só o que mudou
+static ws_state_t status_state;
+static ws_timer_t status_timer;
+
+void update_status(ws_timer_t* timer, void* arg) {
+    uint32_t uptime = to_ms_since_boot(get_absolute_time()) / 1000;
+    ws_state_set_uint(&status_state, "uptime", uptime);
+}
+
 int main() {
     stdio_init_all();
 
@@ -85,10 +81,10 @@ int main() {
     setup_access_point("PicoW-Websockets", "mysockets123", "examples.local");
 
     // Registra rotas HTTP
-    add_http_route("/",        create_index_response);
-    add_http_route("/index",  create_index_response);
-    add_http_route("/status", create_status_response);
-    add_http_route("/mouse",  create_mouse_response);
+    // Páginas fixas: servidas direto da flash, sem formatação nem cópia,
+    // comprimidas com gzip quando o navegador aceita e revalidadas por ETag.
+    // A tabela é gerada pelo htmltoh.py a partir de routes/*.html
+    add_http_route_table(&http_route_table);
 
     // WebSocket: registra esquema e eventos
     add_new_schema_route("websocket", websocket_schema_upgrade);
@@ -100,27 +96,13 @@ int main() {
 
     start_http_server();
 
-    absolute_time_t last = get_absolute_time();
+    // Atualiza "uptime" a cada segundo; o estado envia a mudança aos clientes
+    ws_state_init(&status_state, "/status");
+    ws_timer_init(&status_timer, update_status, NULL);
+    ws_timer_start_aligned(&status_timer, 1000);
 
-    // Loop principal
+    // Loop principal: dorme até haver trabalho de rede ou um timer vencer
     while (true) {
-        cyw43_arch_poll();
-
-        // Envia "uptime" a cada segundo
-        if (absolute_time_diff_us(last, get_absolute_time()) >= 1000000) {
-            last = get_absolute_time();
-
-            uint32_t ms = to_ms_since_boot(get_absolute_time());
-            uint32_t h = ms / 3600000;
-            uint32_t m = (ms / 60000) % 60;
-            uint32_t s = (ms / 1000) % 60;
-
-            char msg[32];
-            int len = snprintf(msg, sizeof(msg), "status:%02u:%02u:%02u", h, m, s);
-
-            ws_send_to_all_clients("/status", WS_OP_TEXT, msg, len);
-        }
-
-        sleep_ms(5);
+        ws_loop_run_once(at_the_end_of_time);
     }
 }
\ No newline at end of file
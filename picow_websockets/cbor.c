@@ -0,0 +1,350 @@
+#include <string.h>
+#include "cbor.h"
+
+#define CBOR_MAJOR_SIMPLE 7
+#define CBOR_AI_FALSE     20
+#define CBOR_AI_TRUE      21
+#define CBOR_AI_NULL      22
+#define CBOR_AI_UNDEFINED 23
+#define CBOR_AI_HALF      25
+#define CBOR_AI_SINGLE    26
+#define CBOR_AI_DOUBLE    27
+
+void cbor_writer_init(cbor_writer_t* w, uint8_t* buf, size_t cap) {
+    w->buf = buf;
+    w->cap = cap;
+    w->len = 0;
+    w->overflow = false;
+}
+
+static bool cbor_reserve(cbor_writer_t* w, size_t n) {
+    if (w->overflow || w->cap - w->len < n) {
+        w->overflow = true;
+        return false;
+    }
+    return true;
+}
+
+// Writes the initial byte plus the shortest argument encoding for `value`
+static bool cbor_put_head(cbor_writer_t* w, uint8_t major, uint64_t value) {
+    uint8_t ib = major << 5;
+    size_t extra;
+
+    if (value < 24)               extra = 0;
+    else if (value <= 0xFF)       extra = 1;
+    else if (value <= 0xFFFF)     extra = 2;
+    else if (value <= 0xFFFFFFFF) extra = 4;
+    else                          extra = 8;
+
+    if (!cbor_reserve(w, 1 + extra)) return false;
+
+    uint8_t* out = w->buf + w->len;
+    switch (extra) {
+        case 0: *out = ib | (uint8_t)value; break;
+        case 1: *out = ib | 24; break;
+        case 2: *out = ib | 25; break;
+        case 4: *out = ib | 26; break;
+        default: *out = ib | 27; break;
+    }
+    for (size_t i = 0; i < extra; i++) {
+        out[1 + i] = (uint8_t)(value >> ((extra - 1 - i) * 8));
+    }
+    w->len += 1 + extra;
+    return true;
+}
+
+bool cbor_put_uint(cbor_writer_t* w, uint64_t value) {
+    return cbor_put_head(w, CBOR_TYPE_UINT, value);
+}
+
+bool cbor_put_int(cbor_writer_t* w, int64_t value) {
+    if (value >= 0) return cbor_put_head(w, CBOR_TYPE_UINT, (uint64_t)value);
+    return cbor_put_head(w, CBOR_TYPE_NEGINT, (uint64_t)(-1 - value));
+}
+
+bool cbor_put_bool(cbor_writer_t* w, bool value) {
+    return cbor_put_head(w, CBOR_MAJOR_SIMPLE, value ? CBOR_AI_TRUE : CBOR_AI_FALSE);
+}
+
+bool cbor_put_null(cbor_writer_t* w) {
+    return cbor_put_head(w, CBOR_MAJOR_SIMPLE, CBOR_AI_NULL);
+}
+
+bool cbor_put_float(cbor_writer_t* w, float value) {
+    if (!cbor_reserve(w, 5)) return false;
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint8_t* out = w->buf + w->len;
+    out[0] = (CBOR_MAJOR_SIMPLE << 5) | CBOR_AI_SINGLE;
+    out[1] = bits >> 24;
+    out[2] = bits >> 16;
+    out[3] = bits >> 8;
+    out[4] = bits;
+    w->len += 5;
+    return true;
+}
+
+static bool cbor_put_string(cbor_writer_t* w, uint8_t major, const void* data, size_t len) {
+    if (!cbor_put_head(w, major, len)) return false;
+    if (!cbor_reserve(w, len)) return false;
+    memcpy(w->buf + w->len, data, len);
+    w->len += len;
+    return true;
+}
+
+bool cbor_put_bytes(cbor_writer_t* w, const uint8_t* data, size_t len) {
+    return cbor_put_string(w, CBOR_TYPE_BYTES, data, len);
+}
+
+bool cbor_put_text(cbor_writer_t* w, const char* text, size_t len) {
+    return cbor_put_string(w, CBOR_TYPE_TEXT, text, len);
+}
+
+bool cbor_put_cstr(cbor_writer_t* w, const char* text) {
+    return cbor_put_string(w, CBOR_TYPE_TEXT, text, strlen(text));
+}
+
+bool cbor_put_raw(cbor_writer_t* w, const uint8_t* encoded, size_t len) {
+    if (!cbor_reserve(w, len)) return false;
+    memcpy(w->buf + w->len, encoded, len);
+    w->len += len;
+    return true;
+}
+
+bool cbor_put_array(cbor_writer_t* w, size_t count) {
+    return cbor_put_head(w, CBOR_TYPE_ARRAY, count);
+}
+
+bool cbor_put_map(cbor_writer_t* w, size_t count) {
+    return cbor_put_head(w, CBOR_TYPE_MAP, count);
+}
+
+void cbor_reader_init(cbor_reader_t* r, const uint8_t* buf, size_t len) {
+    r->buf = buf;
+    r->len = len;
+    r->pos = 0;
+}
+
+// Decodes one item head. Indefinite lengths (ai 31) are not supported.
+static bool cbor_get_head(cbor_reader_t* r, uint8_t* major, uint8_t* ai, uint64_t* arg) {
+    if (r->pos >= r->len) return false;
+
+    uint8_t ib = r->buf[r->pos];
+    *major = ib >> 5;
+    *ai = ib & 0x1F;
+
+    size_t extra;
+    if (*ai < 24)        extra = 0;
+    else if (*ai == 24)  extra = 1;
+    else if (*ai == 25)  extra = 2;
+    else if (*ai == 26)  extra = 4;
+    else if (*ai == 27)  extra = 8;
+    else return false;
+
+    if (r->len - r->pos < 1 + extra) return false;
+
+    uint64_t value = extra ? 0 : *ai;
+    for (size_t i = 0; i < extra; i++) {
+        value = (value << 8) | r->buf[r->pos + 1 + i];
+    }
+    *arg = value;
+    r->pos += 1 + extra;
+    return true;
+}
+
+CBOR_TYPE cbor_peek_type(const cbor_reader_t* r) {
+    if (r->pos >= r->len) return CBOR_TYPE_INVALID;
+
+    uint8_t major = r->buf[r->pos] >> 5;
+    uint8_t ai = r->buf[r->pos] & 0x1F;
+    if (major != CBOR_MAJOR_SIMPLE) return (CBOR_TYPE)major;
+
+    switch (ai) {
+        case CBOR_AI_FALSE:
+        case CBOR_AI_TRUE:      return CBOR_TYPE_BOOL;
+        case CBOR_AI_NULL:
+        case CBOR_AI_UNDEFINED: return CBOR_TYPE_NULL;
+        case CBOR_AI_HALF:
+        case CBOR_AI_SINGLE:
+        case CBOR_AI_DOUBLE:    return CBOR_TYPE_FLOAT;
+        default:                return CBOR_TYPE_INVALID;
+    }
+}
+
+static bool cbor_expect(cbor_reader_t* r, uint8_t want, uint64_t* arg) {
+    size_t start = r->pos;
+    uint8_t major, ai;
+    if (!cbor_get_head(r, &major, &ai, arg) || major != want) {
+        r->pos = start;
+        return false;
+    }
+    return true;
+}
+
+bool cbor_get_uint(cbor_reader_t* r, uint64_t* value) {
+    return cbor_expect(r, CBOR_TYPE_UINT, value);
+}
+
+bool cbor_get_int(cbor_reader_t* r, int64_t* value) {
+    size_t start = r->pos;
+    uint8_t major, ai;
+    uint64_t arg;
+    if (!cbor_get_head(r, &major, &ai, &arg) || arg > INT64_MAX ||
+        (major != CBOR_TYPE_UINT && major != CBOR_TYPE_NEGINT)) {
+        r->pos = start;
+        return false;
+    }
+    *value = major == CBOR_TYPE_UINT ? (int64_t)arg : -1 - (int64_t)arg;
+    return true;
+}
+
+bool cbor_get_bool(cbor_reader_t* r, bool* value) {
+    if (cbor_peek_type(r) != CBOR_TYPE_BOOL) return false;
+    *value = (r->buf[r->pos++] & 0x1F) == CBOR_AI_TRUE;
+    return true;
+}
+
+bool cbor_get_null(cbor_reader_t* r) {
+    if (cbor_peek_type(r) != CBOR_TYPE_NULL) return false;
+    r->pos++;
+    return true;
+}
+
+static float cbor_half_to_float(uint16_t half) {
+    uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    uint32_t exp = (half >> 10) & 0x1F;
+    uint32_t mant = half & 0x3FF;
+    uint32_t bits;
+
+    if (exp == 0x1F) {
+        bits = sign | 0x7F800000 | (mant << 13);
+    } else if (exp != 0) {
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+    } else if (mant == 0) {
+        bits = sign;
+    } else {
+        // Subnormal half: normalize into a regular single
+        exp = 113;
+        while (!(mant & 0x400)) {
+            mant <<= 1;
+            exp--;
+        }
+        bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+    }
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+bool cbor_get_float(cbor_reader_t* r, float* value) {
+    size_t start = r->pos;
+    uint8_t major, ai;
+    uint64_t arg;
+    if (!cbor_get_head(r, &major, &ai, &arg)) return false;
+
+    if (major == CBOR_TYPE_UINT) {
+        *value = (float)arg;
+        return true;
+    }
+    if (major == CBOR_TYPE_NEGINT) {
+        *value = -1.0f - (float)arg;
+        return true;
+    }
+    if (major == CBOR_MAJOR_SIMPLE) {
+        if (ai == CBOR_AI_HALF) {
+            *value = cbor_half_to_float((uint16_t)arg);
+            return true;
+        }
+        if (ai == CBOR_AI_SINGLE) {
+            uint32_t bits = (uint32_t)arg;
+            memcpy(value, &bits, sizeof(*value));
+            return true;
+        }
+        if (ai == CBOR_AI_DOUBLE) {
+            double d;
+            memcpy(&d, &arg, sizeof(d));
+            *value = (float)d;
+            return true;
+        }
+    }
+
+    r->pos = start;
+    return false;
+}
+
+static bool cbor_get_string(cbor_reader_t* r, uint8_t major, const uint8_t** data, size_t* len) {
+    size_t start = r->pos;
+    uint64_t arg;
+    if (!cbor_expect(r, major, &arg)) return false;
+    if (arg > r->len - r->pos) {
+        r->pos = start;
+        return false;
+    }
+    *data = r->buf + r->pos;
+    *len = (size_t)arg;
+    r->pos += (size_t)arg;
+    return true;
+}
+
+bool cbor_get_bytes(cbor_reader_t* r, const uint8_t** data, size_t* len) {
+    return cbor_get_string(r, CBOR_TYPE_BYTES, data, len);
+}
+
+bool cbor_get_text(cbor_reader_t* r, const char** text, size_t* len) {
+    return cbor_get_string(r, CBOR_TYPE_TEXT, (const uint8_t**)text, len);
+}
+
+bool cbor_get_array(cbor_reader_t* r, size_t* count) {
+    uint64_t arg;
+    if (!cbor_expect(r, CBOR_TYPE_ARRAY, &arg)) return false;
+    *count = (size_t)arg;
+    return true;
+}
+
+bool cbor_get_map(cbor_reader_t* r, size_t* count) {
+    uint64_t arg;
+    if (!cbor_expect(r, CBOR_TYPE_MAP, &arg)) return false;
+    *count = (size_t)arg;
+    return true;
+}
+
+bool cbor_skip(cbor_reader_t* r) {
+    size_t start = r->pos;
+    uint64_t pending = 1;
+
+    while (pending) {
+        uint8_t major, ai;
+        uint64_t arg;
+        if (!cbor_get_head(r, &major, &ai, &arg)) goto fail;
+        pending--;
+
+        // Every nested item needs at least one byte, which bounds `pending`
+        uint64_t remaining = r->len - r->pos;
+        switch (major) {
+            case CBOR_TYPE_BYTES:
+            case CBOR_TYPE_TEXT:
+                if (arg > remaining) goto fail;
+                r->pos += (size_t)arg;
+                break;
+            case CBOR_TYPE_ARRAY:
+                if (arg > remaining) goto fail;
+                pending += arg;
+                break;
+            case CBOR_TYPE_MAP:
+                if (arg > remaining / 2) goto fail;
+                pending += 2 * arg;
+                break;
+            case CBOR_TYPE_TAG:
+                pending += 1;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+
+fail:
+    r->pos = start;
+    return false;
+}
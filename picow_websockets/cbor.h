@@ -0,0 +1,125 @@
+#ifndef CBOR_H
+#define CBOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @enum CBOR_TYPE
+ * @brief CBOR major types, plus the decoded simple values.
+ */
+typedef enum {
+    CBOR_TYPE_UINT    = 0, /**< Unsigned integer (major 0). */
+    CBOR_TYPE_NEGINT  = 1, /**< Negative integer (major 1). */
+    CBOR_TYPE_BYTES   = 2, /**< Byte string (major 2). */
+    CBOR_TYPE_TEXT    = 3, /**< UTF-8 text string (major 3). */
+    CBOR_TYPE_ARRAY   = 4, /**< Array (major 4). */
+    CBOR_TYPE_MAP     = 5, /**< Map (major 5). */
+    CBOR_TYPE_TAG     = 6, /**< Tagged item (major 6). */
+    CBOR_TYPE_BOOL    = 7, /**< true / false. */
+    CBOR_TYPE_NULL    = 8, /**< null / undefined. */
+    CBOR_TYPE_FLOAT   = 9, /**< Half, single or double precision float. */
+    CBOR_TYPE_INVALID = -1 /**< End of input or unsupported encoding. */
+} CBOR_TYPE;
+
+/**
+ * @struct cbor_writer_t
+ * @brief Streaming encoder writing into a caller-owned buffer.
+ *
+ * Every put function returns false once the buffer is exhausted; the writer
+ * then stays in the overflow state so a whole record can be checked once.
+ */
+typedef struct {
+    uint8_t* buf;      /**< Destination buffer. */
+    size_t   cap;      /**< Size of the destination buffer. */
+    size_t   len;      /**< Bytes written so far. */
+    bool     overflow; /**< Set when an item did not fit. */
+} cbor_writer_t;
+
+/**
+ * @struct cbor_reader_t
+ * @brief Zero-copy decoder over a received buffer.
+ */
+typedef struct {
+    const uint8_t* buf; /**< Encoded input. */
+    size_t         len; /**< Input length. */
+    size_t         pos; /**< Offset of the next item. */
+} cbor_reader_t;
+
+/**
+ * @brief Initialize a writer over `buf`.
+ * @param w   Writer to initialize.
+ * @param buf Destination buffer (e.g. the pointer returned by ws_frame_begin()).
+ * @param cap Size of the destination buffer.
+ */
+void cbor_writer_init(cbor_writer_t* w, uint8_t* buf, size_t cap);
+
+bool cbor_put_uint(cbor_writer_t* w, uint64_t value);
+bool cbor_put_int(cbor_writer_t* w, int64_t value);
+bool cbor_put_bool(cbor_writer_t* w, bool value);
+bool cbor_put_null(cbor_writer_t* w);
+bool cbor_put_float(cbor_writer_t* w, float value);
+bool cbor_put_bytes(cbor_writer_t* w, const uint8_t* data, size_t len);
+bool cbor_put_text(cbor_writer_t* w, const char* text, size_t len);
+bool cbor_put_cstr(cbor_writer_t* w, const char* text);
+
+/**
+ * @brief Append an item that is already CBOR-encoded.
+ */
+bool cbor_put_raw(cbor_writer_t* w, const uint8_t* encoded, size_t len);
+
+/**
+ * @brief Open a definite-length array; the next `count` items are its elements.
+ */
+bool cbor_put_array(cbor_writer_t* w, size_t count);
+
+/**
+ * @brief Open a definite-length map; the next `2 * count` items are key/value pairs.
+ */
+bool cbor_put_map(cbor_writer_t* w, size_t count);
+
+/**
+ * @brief Initialize a reader over `buf`.
+ * @param r   Reader to initialize.
+ * @param buf Encoded input, typically a received WebSocket payload.
+ * @param len Input length.
+ */
+void cbor_reader_init(cbor_reader_t* r, const uint8_t* buf, size_t len);
+
+/**
+ * @brief Type of the next item without consuming it.
+ * @return CBOR_TYPE_INVALID at end of input.
+ */
+CBOR_TYPE cbor_peek_type(const cbor_reader_t* r);
+
+bool cbor_get_uint(cbor_reader_t* r, uint64_t* value);
+bool cbor_get_int(cbor_reader_t* r, int64_t* value);
+bool cbor_get_bool(cbor_reader_t* r, bool* value);
+bool cbor_get_null(cbor_reader_t* r);
+
+/**
+ * @brief Read a float, accepting half, single, double and integer encodings.
+ */
+bool cbor_get_float(cbor_reader_t* r, float* value);
+
+/**
+ * @brief Read a byte string. `data` points into the input buffer (no copy).
+ */
+bool cbor_get_bytes(cbor_reader_t* r, const uint8_t** data, size_t* len);
+
+/**
+ * @brief Read a text string. `text` points into the input buffer and is not
+ *        NUL-terminated.
+ */
+bool cbor_get_text(cbor_reader_t* r, const char** text, size_t* len);
+
+bool cbor_get_array(cbor_reader_t* r, size_t* count);
+bool cbor_get_map(cbor_reader_t* r, size_t* count);
+
+/**
+ * @brief Skip the next item, including nested arrays, maps and tags.
+ */
+bool cbor_skip(cbor_reader_t* r);
+
+#endif /* CBOR_H */
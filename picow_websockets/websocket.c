@@ -1,12 +1,72 @@
+#include "pico/cyw43_arch.h"
 #include "websocket.h"
 #include "encrypt.h"
+#include "ws_state.h"
+#include "ws_governor.h"
+#include "ws_dispatch.h"
 
-ws_connected_clients_t* ws_connected_clients = NULL;
+#define WS_POLL_INTERVAL 2
+
+static ws_client ws_client_slots[WS_MAX_CLIENTS];
+static ws_connected_clients_t ws_client_table = {.items = ws_client_slots, .capacity = WS_MAX_CLIENTS};
+static ws_pool_stats_t ws_client_stats = {.capacity = WS_MAX_CLIENTS};
+
+ws_connected_clients_t* ws_connected_clients = &ws_client_table;
 ws_context_handlers_t ws_context_handlers = {0};
 
+WS_POOL_DEFINE(ws_route_pool, WS_ROUTE_MAX_LEN, WS_MAX_CLIENTS);
+
 static uint8_t frame_buf[WS_BUFFER_SIZE];
 static uint8_t out_buf[WS_BUFFER_SIZE];
 
+// Returns a free slot without claiming it; the slot is taken once its tpcb is set
+static ws_client* ws_client_slot_find(void){
+    for(size_t ii = 0 ; ii < ws_connected_clients->count ; ii++){
+        if(ws_connected_clients->items[ii].tpcb == NULL){
+            return &ws_connected_clients->items[ii];
+        }
+    }
+    if(ws_connected_clients->count < ws_connected_clients->capacity){
+        return &ws_connected_clients->items[ws_connected_clients->count];
+    }
+    ws_client_stats.failures++;
+    return NULL;
+}
+
+static void ws_client_slot_claim(ws_client* slot, struct tcp_pcb* tpcb, char* route){
+    if(slot == &ws_connected_clients->items[ws_connected_clients->count]){
+        ws_connected_clients->count++;
+    }
+    *slot = (ws_client){.tpcb=tpcb,.route=route,.generation=slot->generation};
+    ws_client_stats.in_use++;
+    if(ws_client_stats.in_use > ws_client_stats.peak) ws_client_stats.peak = ws_client_stats.in_use;
+}
+
+static ws_client* ws_client_find(struct tcp_pcb* tpcb){
+    for(size_t ii = 0 ; ii < ws_connected_clients->count ; ii++){
+        if(ws_connected_clients->items[ii].tpcb == tpcb){
+            return &ws_connected_clients->items[ii];
+        }
+    }
+    return NULL;
+}
+
+static void ws_client_release(struct tcp_pcb* tpcb){
+    for(size_t ii = 0 ; ii < ws_connected_clients->count ; ii++){
+        if(ws_connected_clients->items[ii].tpcb == tpcb){
+            ws_pool_free(&ws_route_pool, ws_connected_clients->items[ii].route);
+            ws_connected_clients->items[ii] = (ws_client){.generation=ws_connected_clients->items[ii].generation + 1};
+            ws_client_stats.in_use--;
+            return;
+        }
+    }
+}
+
+void ws_get_memory_stats(ws_memory_stats_t* stats){
+    stats->clients = ws_client_stats;
+    stats->routes = ws_route_pool.stats;
+}
+
 bool extract_ws_key(const char *req, char *out_key, size_t maxlen) {
     static const char key[] = "Sec-WebSocket-Key:";
     const char *p = strstr(req, key);
@@ -47,6 +107,57 @@ char* ws_get_client_route(ws_client_tpcb wc){
             return ws_connected_clients->items[ii].route;
         }
     }
+    return NULL;
+}
+
+ws_client_id_t ws_client_id(ws_client_tpcb wc){
+    for(size_t ii = 0 ; wc && ii < ws_connected_clients->count ; ii++){
+        if(ws_connected_clients->items[ii].tpcb == wc){
+            return (ws_client_id_t){.slot = ii, .generation = ws_connected_clients->items[ii].generation};
+        }
+    }
+    return WS_CLIENT_ID_NONE;
+}
+
+ws_client_tpcb ws_client_resolve(ws_client_id_t id){
+    if(id.slot >= ws_connected_clients->count) return NULL;
+    ws_client* client = &ws_connected_clients->items[id.slot];
+    return client->generation == id.generation ? client->tpcb : NULL;
+}
+
+char* ws_client_get_ip(ws_client_id_t id, char *buf, size_t buflen){
+    cyw43_arch_lwip_begin();
+    char* res = ws_get_client_ip(ws_client_resolve(id), buf, buflen);
+    cyw43_arch_lwip_end();
+    return res;
+}
+
+char* ws_client_get_route(ws_client_id_t id, char *buf, size_t buflen){
+    char* res = NULL;
+    cyw43_arch_lwip_begin();
+    if(ws_client_resolve(id) && buflen > 0){
+        snprintf(buf, buflen, "%s", ws_connected_clients->items[id.slot].route);
+        res = buf;
+    }
+    cyw43_arch_lwip_end();
+    return res;
+}
+
+void ws_client_recved(ws_client_id_t id, uint16_t len){
+    ws_client_tpcb tpcb = ws_client_resolve(id);
+    if(!tpcb) return;
+    uint16_t credit = ws_governor_recv_credit(&ws_connected_clients->items[id.slot].rx_withheld, len);
+    if(credit) tcp_recved(tpcb, credit);
+}
+
+bool ws_route_has_clients(const char* route){
+    if(ws_connected_clients == NULL) return false;
+    for(int ii = 0 ; ii < ws_connected_clients->count ; ii++){
+        if(ws_connected_clients->items[ii].tpcb && strcmp(ws_connected_clients->items[ii].route,route) == 0){
+            return true;
+        }
+    }
+    return false;
 }
 
 void ws_add_on_text_handler(ws_message_handler handler){
@@ -70,50 +181,110 @@ void ws_send_message(ws_client_tpcb wc, WS_OPCODE opcode, uint8_t *msg, uint64_t
     tcp_write(wc, out_buf, out_len, TCP_WRITE_FLAG_COPY);   
 }
 
+uint8_t* ws_frame_begin(size_t* capacity){
+    *capacity = WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX;
+    return out_buf + WS_FRAME_HEADER_MAX;
+}
+
+uint8_t* ws_frame_wrap(uint8_t* payload, WS_OPCODE opcode, packet_length payload_len, packet_length* frame_len){
+    uint8_t header_len = payload_len < 126 ? 2 : 4;
+    uint8_t* frame = payload - header_len;
+
+    frame[0] = (1 << 7) | (opcode & 0x0F);
+    if (header_len == 2) {
+        frame[1] = payload_len;
+    } else {
+        frame[1] = 126;
+        frame[2] = (payload_len >> 8) & 0xFF;
+        frame[3] = payload_len & 0xFF;
+    }
+
+    *frame_len = header_len + payload_len;
+    return frame;
+}
+
+void ws_frame_send(ws_client_tpcb wc, WS_OPCODE opcode, packet_length payload_len){
+    if (payload_len > WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX) return;
+    packet_length frame_len;
+    uint8_t* frame = ws_frame_wrap(out_buf + WS_FRAME_HEADER_MAX, opcode, payload_len, &frame_len);
+    tcp_write(wc, frame, frame_len, TCP_WRITE_FLAG_COPY);
+}
+
+void ws_frame_send_to_all_clients(const char* route, WS_OPCODE opcode, packet_length payload_len){
+    if (payload_len > WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX) return;
+    packet_length frame_len;
+    uint8_t* frame = ws_frame_wrap(out_buf + WS_FRAME_HEADER_MAX, opcode, payload_len, &frame_len);
+    ws_send_frame_to_all_clients(route, frame, frame_len);
+}
+
+size_t ws_send_frame_to_all_clients(const char* route, const uint8_t* frame, packet_length frame_len){
+    size_t refused = 0;
+    if(ws_connected_clients == NULL) return 0;
+    for(int ii = 0 ; ii < ws_connected_clients->count ; ii++){
+        if(ws_connected_clients->items[ii].tpcb && strcmp(ws_connected_clients->items[ii].route,route) == 0){
+            if(tcp_write(ws_connected_clients->items[ii].tpcb, frame, frame_len, TCP_WRITE_FLAG_COPY) != ERR_OK) refused++;
+        }
+    }
+    return refused;
+}
+
+// Every close goes through here, so the slot is freed and lwIP can no longer
+// call back into a slot that a later client may hold
+static err_t websocket_close(struct tcp_pcb *tpcb) {
+    ws_client_release(tpcb);
+    tcp_arg(tpcb, NULL);
+    tcp_err(tpcb, NULL);
+    tcp_recv(tpcb, NULL);
+    tcp_poll(tpcb, NULL, 0);
+    if (tcp_close(tpcb) != ERR_OK) {
+        tcp_abort(tpcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+// Reset or aborted by lwIP: the pcb is already freed, only its slot is left
+static void websocket_err(void *arg, err_t err) {
+    ws_client* client = arg;
+    if (client && client->tpcb) ws_client_release(client->tpcb);
+}
+
 static err_t websocket_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
     if (!p) {
-        tcp_close(tpcb);
-        return ERR_OK;
+        return websocket_close(tpcb);
+    }
+
+    // Text frames go to the application loop with their pbuf and window credit
+    if (ws_get_dispatch_mode() == WS_DISPATCH_DEFERRED && (pbuf_get_at(p, 0) & 0x0F) == WS_OP_TEXT) {
+        return ws_dispatch_receive(tpcb, p);
     }
     
-    tcp_recved(tpcb, p->tot_len);
+    ws_client* client = ws_client_find(tpcb);
+    tcp_recved(tpcb, client ? ws_governor_recv_credit(&client->rx_withheld, p->tot_len) : p->tot_len);
     
     ws_packet_header_t hdr;
 
+    // Freed here, so lwIP must not be told to keep it (ERR_MEM)
     if (p->tot_len > WS_BUFFER_SIZE) {
-        tcp_close(tpcb);
         pbuf_free(p);
-        return ERR_MEM;
+        return websocket_close(tpcb);
     }
 
-    uint32_t offset = 0;
-    for (struct pbuf *q = p; q; q = q->next) {
-        if (offset + q->len > WS_BUFFER_SIZE) {
-            pbuf_free(p);
-            return ERR_MEM;
-        }
-        memcpy(frame_buf + offset, q->payload, q->len);
-        offset += q->len;
-    }
-    
-    uint32_t total_len = offset;
+    uint32_t total_len = pbuf_copy_partial(p, frame_buf, p->tot_len, 0);
 
-    ws_parse_packet(&hdr, frame_buf, total_len);
+    // Incomplete or oversized frames are dropped, as in ws_dispatch_receive()
+    if (ws_parse_packet(&hdr, frame_buf, total_len) != WS_PARSE_SUCCESS) {
+        pbuf_free(p);
+        return ERR_OK;
+    }
 
     switch (hdr.meta.bits.OPCODE) {
-        case WS_OP_TEXT: {
-            uint32_t msg_len = hdr.length;
-            
-            char *msg = malloc(msg_len);
-            memcpy(msg, frame_buf + hdr.start, msg_len);
-            
+        case WS_OP_TEXT:
+            // Unmasked in place: the handler gets the payload where it lies
             if(ws_context_handlers.on_text){
-                ws_context_handlers.on_text(tpcb,msg,msg_len);
+                ws_context_handlers.on_text(tpcb,frame_buf + hdr.start,hdr.length);
             }
-            
-            free(msg);
             break;
-        }
 
         case WS_OP_PING: {
             uint64_t out_len = ws_build_packet(out_buf,WS_BUFFER_SIZE,WS_OP_PONG,frame_buf + hdr.start,hdr.length,0);
@@ -138,16 +309,7 @@ static err_t websocket_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err
             tcp_write(tpcb, out_buf, out_len, TCP_WRITE_FLAG_COPY);
             tcp_output(tpcb);
             pbuf_free(p);
-            tcp_close(tpcb);
-            
-            for(int ii = 0 ; ii < ws_connected_clients->count ; ii++){
-                if(ws_connected_clients->items[ii].tpcb == tpcb){
-                    ws_connected_clients->items[ii].tpcb = NULL;
-                    free(ws_connected_clients->items[ii].route);
-                }
-            }
-
-            return ERR_OK;
+            return websocket_close(tpcb);
         }
 
         default:
@@ -170,6 +332,16 @@ void ws_send_to_all_clients(const char* route,WS_OPCODE opcode, uint8_t *msg, ui
     }
 };
 
+// Returns receive window credit withheld under memory pressure once it eases
+static err_t websocket_poll(void *arg, struct tcp_pcb *tpcb) {
+    ws_client* client = ws_client_find(tpcb);
+    if (client && client->rx_withheld) {
+        uint16_t credit = ws_governor_recv_credit(&client->rx_withheld, 0);
+        if (credit) tcp_recved(tpcb, credit);
+    }
+    return ERR_OK;
+}
+
 int websocket_handshake(struct tcp_pcb *tpcb, char *req) {
     uint8_t client_key[256];
     uint8_t accept_key[256];
@@ -194,39 +366,41 @@ int websocket_handshake(struct tcp_pcb *tpcb, char *req) {
     tcp_output(tpcb);
 
     tcp_recv(tpcb, websocket_recv);
+    tcp_poll(tpcb, websocket_poll, WS_POLL_INTERVAL);
 
     return ERR_OK;
 }
 
 err_t websocket_schema_upgrade(char* payload_buffer,struct tcp_pcb *tpcb, struct pbuf *p){
+    if (!ws_governor_admit()) {
+        pbuf_free(p);
+        return ws_governor_reject(tpcb);
+    }
+
+    ws_client* slot = ws_client_slot_find();
+    char* route = slot ? ws_pool_alloc(&ws_route_pool) : NULL;
+    if (!route) {
+        pbuf_free(p);
+        return ws_governor_reject(tpcb);
+    }
+
     int err = websocket_handshake(tpcb, payload_buffer);
     if (err == ERR_OK){
+        char *line_end = strstr(payload_buffer, "\r\n");
+        if (line_end) *line_end = '\0';
+        char method[8];
+        if (sscanf(payload_buffer, "%7s %63s", method, route) != 2) route[0] = '\0';
+        ws_client_slot_claim(slot, tpcb, route);
+        tcp_arg(tpcb, slot);
+        tcp_err(tpcb, websocket_err);
+
         if(ws_context_handlers.on_upgrade){
             ws_context_handlers.on_upgrade(tpcb,NULL,0);
         }
-
-        if(ws_connected_clients == NULL){
-            ws_connected_clients = (ws_connected_clients_t*)calloc(1,sizeof(ws_connected_clients_t));
-        } 
-        
-        if (ws_connected_clients->count >= ws_connected_clients->capacity) {                                         
-            if (ws_connected_clients->capacity == 0) ws_connected_clients->capacity = 4;                           
-            else ws_connected_clients->capacity *= 2;                                                
-            ws_connected_clients->items = realloc(ws_connected_clients->items, ws_connected_clients->capacity*sizeof(*ws_connected_clients->items)); 
-        }                         
-
-        int len = p->tot_len < sizeof(payload_buffer) - 1
-                  ? p->tot_len
-                  : sizeof(payload_buffer) - 1;
-
-        char *line_end = strstr(payload_buffer, "\r\n");
-        if (!line_end) line_end = payload_buffer + len;
-        *line_end = '\0';
-        char* route = (char*)malloc(64*sizeof(char));
-        char method[8];
-        sscanf(payload_buffer, "%7s %63s", method, route);
-        ws_connected_clients->items[ws_connected_clients->count++] = (ws_client){.tpcb=tpcb,.route=route};
-    }        
+        ws_state_send_snapshots(tpcb, route);
+    } else {
+        ws_pool_free(&ws_route_pool, route);
+    }
     pbuf_free(p);
     return err;
-};
\ No newline at end of file
+};
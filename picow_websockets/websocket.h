@@ -6,15 +6,43 @@
 #include <string.h>
 #include <stdlib.h>
 #include <lwip/tcp.h>
+#include "ws_pool.h"
 
 #define WS_BUFFER_SIZE 2048
 
+#ifndef WS_MAX_CLIENTS
+#define WS_MAX_CLIENTS 8
+#endif
+
+#define WS_ROUTE_MAX_LEN 64
+
+/**
+ * @brief Largest header ws_frame_send() prepends (unmasked, payload < 64 KiB).
+ */
+#define WS_FRAME_HEADER_MAX 4
+
 /**
  * @typedef ws_client_tpcb
  * @brief Opaque handle for a WebSocket client, represented by a TCP PCB pointer.
  */
 typedef struct tcp_pcb* ws_client_tpcb;
 
+/**
+ * @struct ws_client_id_t
+ * @brief Generation-checked reference to a client, for code running outside
+ *        the lwIP context.
+ *
+ * A tcp_pcb pointer is freed by lwIP when its connection drops and may be
+ * reused for the next one. An id names a client slot and the generation of
+ * its occupant, so once the client is gone it resolves to nothing.
+ */
+typedef struct {
+    uint16_t slot;       /**< Index in the client table, WS_CLIENT_ID_NONE.slot if none. */
+    uint16_t generation; /**< Generation of the slot's occupant. */
+} ws_client_id_t;
+
+#define WS_CLIENT_ID_NONE ((ws_client_id_t){.slot = UINT16_MAX})
+
 /**
  * @typedef output_payload_len
  * @brief Alias for payload length type.
@@ -93,20 +121,31 @@ typedef enum {
  * @brief Represents a connected WebSocket client and its associated route.
  */
 typedef struct {
-    ws_client_tpcb tpcb;  /**< TCP PCB pointer for the client. */
-    char*          route; /**< HTTP route used for upgrade. */
+    ws_client_tpcb tpcb;        /**< TCP PCB pointer for the client. */
+    char*          route;       /**< HTTP route used for upgrade. */
+    uint16_t       rx_withheld; /**< Receive window credit held back under memory pressure. */
+    uint16_t       generation;  /**< Bumped on release; tells a reused slot from its previous client. */
 } ws_client;
 
 /**
  * @struct ws_connected_clients_t
- * @brief Dynamic array of connected WebSocket clients.
+ * @brief Fixed table of WebSocket client slots. Slots whose tpcb is NULL are free.
  */
 typedef struct {
-    ws_client *items;     /**< Array of client entries. */
-    size_t     count;     /**< Current number of clients. */
-    size_t     capacity;  /**< Allocated capacity of the array. */
+    ws_client *items;     /**< Array of client slots. */
+    size_t     count;     /**< Number of slots ever used (high-water index). */
+    size_t     capacity;  /**< Number of slots, WS_MAX_CLIENTS. */
 } ws_connected_clients_t;
 
+/**
+ * @struct ws_memory_stats_t
+ * @brief Usage counters of the library's fixed memory pools.
+ */
+typedef struct {
+    ws_pool_stats_t clients; /**< Client slots. */
+    ws_pool_stats_t routes;  /**< Per-client route strings. */
+} ws_memory_stats_t;
+
 /**
  * @typedef packet_length
  * @brief Type for WebSocket packet length values.
@@ -171,6 +210,56 @@ char* ws_get_client_ip(ws_client_tpcb wc, char *buf, size_t buflen);
  */
 char* ws_get_client_route(ws_client_tpcb wc);
 
+/**
+ * @brief Id of a connected client. Call from lwIP context.
+ * @param wc WebSocket client handle.
+ * @return The client's id, or WS_CLIENT_ID_NONE if it is not connected.
+ */
+ws_client_id_t ws_client_id(ws_client_tpcb wc);
+
+/**
+ * @brief Resolve an id to its client's PCB. The PCB is only valid while the
+ *        lwIP lock is held, so call from lwIP context or between
+ *        cyw43_arch_lwip_begin() and cyw43_arch_lwip_end().
+ * @return The PCB, or NULL once the client is gone.
+ */
+ws_client_tpcb ws_client_resolve(ws_client_id_t id);
+
+/**
+ * @brief ws_get_client_ip() for an id. Takes the lwIP lock, so it may be
+ *        called from any context.
+ * @return Pointer to buf, or NULL if the client is gone.
+ */
+char* ws_client_get_ip(ws_client_id_t id, char *buf, size_t buflen);
+
+/**
+ * @brief Copy the upgrade route of a client. Takes the lwIP lock, so it may
+ *        be called from any context.
+ * @return Pointer to buf, or NULL if the client is gone.
+ */
+char* ws_client_get_route(ws_client_id_t id, char *buf, size_t buflen);
+
+/**
+ * @brief Acknowledge `len` received bytes of a client with tcp_recved(),
+ *        withholding part of the credit under memory pressure
+ *        (ws_governor_recv_credit()). Ignored once the client is gone.
+ *        Called by the library from lwIP context.
+ */
+void ws_client_recved(ws_client_id_t id, uint16_t len);
+
+/**
+ * @brief Check whether any connected client upgraded on `route`.
+ * @param route HTTP route to look for.
+ * @return true if at least one client is subscribed to the route.
+ */
+bool ws_route_has_clients(const char* route);
+
+/**
+ * @brief Snapshot the usage counters of the library's memory pools.
+ * @param stats Receives the counters.
+ */
+void ws_get_memory_stats(ws_memory_stats_t* stats);
+
 /**
  * @brief Send a WebSocket message to a single client.
  * @param wc      WebSocket client handle.
@@ -191,6 +280,56 @@ void ws_send_message(ws_client_tpcb wc, WS_OPCODE opcode,
 void ws_send_to_all_clients(const char* route, WS_OPCODE opcode,
                             uint8_t *msg, packet_length msg_len);
 
+/**
+ * @brief Reserve the payload area of the shared outbound frame buffer.
+ *
+ * Lets encoders (e.g. cbor_writer_t) write a payload in place so it is not
+ * copied again when framed. The area stays valid until the next send call.
+ * @param capacity Receives the number of payload bytes available.
+ * @return Pointer to the payload area.
+ */
+uint8_t* ws_frame_begin(size_t* capacity);
+
+/**
+ * @brief Frame and send the payload written after ws_frame_begin().
+ * @param wc          WebSocket client handle.
+ * @param opcode      WebSocket opcode.
+ * @param payload_len Number of payload bytes written.
+ */
+void ws_frame_send(ws_client_tpcb wc, WS_OPCODE opcode, packet_length payload_len);
+
+/**
+ * @brief Frame the payload written after ws_frame_begin() once and broadcast
+ *        it to all clients on a given route.
+ * @param route       HTTP route used by target clients.
+ * @param opcode      WebSocket opcode.
+ * @param payload_len Number of payload bytes written.
+ */
+void ws_frame_send_to_all_clients(const char* route, WS_OPCODE opcode,
+                                  packet_length payload_len);
+
+/**
+ * @brief Write an unmasked frame header into the WS_FRAME_HEADER_MAX bytes
+ *        that precede `payload`.
+ * @param payload     Payload, preceded by WS_FRAME_HEADER_MAX writable bytes.
+ * @param opcode      WebSocket opcode.
+ * @param payload_len Payload length (below 64 KiB).
+ * @param frame_len   Receives the length of the complete frame.
+ * @return Start of the frame, between `payload - WS_FRAME_HEADER_MAX` and `payload`.
+ */
+uint8_t* ws_frame_wrap(uint8_t* payload, WS_OPCODE opcode,
+                       packet_length payload_len, packet_length* frame_len);
+
+/**
+ * @brief Write an already framed message to all clients on a given route.
+ * @param route     HTTP route used by target clients.
+ * @param frame     Complete frame.
+ * @param frame_len Frame length.
+ * @return Number of clients whose write lwIP refused.
+ */
+size_t ws_send_frame_to_all_clients(const char* route, const uint8_t* frame,
+                                    packet_length frame_len);
+
 /**
  * @brief Register a callback for incoming text frames.
  * @param handler Function to call on text frame.
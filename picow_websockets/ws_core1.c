@@ -0,0 +1,31 @@
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "ws_core1.h"
+#include "ws_dispatch.h"
+
+static ws_core1_idle_fn ws_core1_idle = NULL;
+static volatile bool ws_core1_running = false;
+
+static void ws_core1_main(void){
+    while (true) {
+        bool busy = ws_dispatch_drain(WS_CORE1_BATCH) > 0;
+        if (ws_core1_idle && ws_core1_idle()) busy = true;
+
+        // ws_dispatch_receive() signals __sev() when core0 queues a message
+        if (!busy && ws_dispatch_pending() == 0) __wfe();
+    }
+}
+
+void ws_core1_worker_start(ws_core1_idle_fn idle){
+    if (ws_core1_running) return;
+
+    ws_set_dispatch_mode(WS_DISPATCH_DEFERRED);
+    ws_core1_idle = idle;
+    ws_core1_running = true;
+    ws_dispatch_set_consumer_core(1);
+    multicore_launch_core1(ws_core1_main);
+}
+
+bool ws_core1_worker_running(void){
+    return ws_core1_running;
+}
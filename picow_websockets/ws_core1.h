@@ -0,0 +1,47 @@
+#ifndef WS_CORE1_H
+#define WS_CORE1_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Messages handled per pass before core1 runs its idle hook again.
+ */
+#ifndef WS_CORE1_BATCH
+#define WS_CORE1_BATCH 4
+#endif
+
+/**
+ * @typedef ws_core1_idle_fn
+ * @brief Application work run on core1 between message batches
+ *        (encoding, compression, periodic producers).
+ * @return true if it did work and should be called again right away,
+ *         false to let core1 sleep until the next message arrives.
+ */
+typedef bool(*ws_core1_idle_fn)(void);
+
+/*
+ * Split mode: core0 keeps lwIP, the cyw43 driver, HTTP parsing and WebSocket
+ * framing; core1 runs the deferred message handler and any application
+ * encoding.
+ *
+ *   core0 (lwIP)  --ws_dispatch ring-->  core1 (handlers)
+ *   core1         --ws_send_queue ring--> core0 (lwIP writes)
+ *
+ * Both rings are single-producer/single-consumer and lock-free. Handlers on
+ * core1 get client ids, never PCBs, and reply with
+ * ws_post_message()/ws_post_to_all_clients().
+ */
+
+/**
+ * @brief Switch to deferred dispatch and launch the core1 worker loop.
+ * @param idle Optional application hook run on core1, may be NULL.
+ */
+void ws_core1_worker_start(ws_core1_idle_fn idle);
+
+/**
+ * @brief Whether the core1 worker owns message dispatch.
+ */
+bool ws_core1_worker_running(void);
+
+#endif /* WS_CORE1_H */
@@ -0,0 +1,132 @@
+#include "pico/cyw43_arch.h"
+#include "hardware/sync.h"
+#include "ws_dispatch.h"
+
+#define WS_DISPATCH_MASK (WS_DISPATCH_QUEUE_LEN - 1)
+
+// Single producer (lwIP context) / single consumer (application loop) ring.
+// head:    next slot the producer fills
+// tail:    next slot the consumer dispatches
+// reclaim: next dispatched slot whose pbuf is released back in lwIP context
+static ws_dispatch_item_t ws_dispatch_ring[WS_DISPATCH_QUEUE_LEN];
+static volatile uint32_t ws_dispatch_head = 0;
+static volatile uint32_t ws_dispatch_tail = 0;
+static volatile uint32_t ws_dispatch_reclaim = 0;
+
+static WS_DISPATCH_MODE ws_dispatch_mode = WS_DISPATCH_INLINE;
+static ws_dispatch_handler ws_dispatch_on_text = NULL;
+static volatile int ws_dispatch_consumer = -1;
+static uint32_t ws_dispatch_total = 0;
+
+static void ws_dispatch_reclaim_work(async_context_t *context, async_when_pending_worker_t *worker);
+static async_when_pending_worker_t ws_dispatch_reclaim_worker = {.do_work = ws_dispatch_reclaim_work};
+
+// Frees handled messages and reopens their TCP window. Runs in lwIP context.
+static void ws_dispatch_reclaim_work(async_context_t *context, async_when_pending_worker_t *worker){
+    uint32_t tail = ws_dispatch_tail;
+    __dmb();
+    while (ws_dispatch_reclaim != tail) {
+        ws_dispatch_item_t* item = &ws_dispatch_ring[ws_dispatch_reclaim & WS_DISPATCH_MASK];
+        ws_client_recved(item->client, item->credit);
+        pbuf_free(item->p);
+        item->p = NULL;
+        ws_dispatch_reclaim++;
+    }
+}
+
+void ws_set_dispatch_mode(WS_DISPATCH_MODE mode){
+    cyw43_arch_lwip_begin();
+    if (mode == WS_DISPATCH_DEFERRED && ws_dispatch_mode != WS_DISPATCH_DEFERRED) {
+        async_context_add_when_pending_worker(cyw43_arch_async_context(), &ws_dispatch_reclaim_worker);
+    }
+    ws_dispatch_mode = mode;
+    cyw43_arch_lwip_end();
+}
+
+void ws_set_dispatch_handler(ws_dispatch_handler handler){
+    ws_dispatch_on_text = handler;
+}
+
+WS_DISPATCH_MODE ws_get_dispatch_mode(void){
+    return ws_dispatch_mode;
+}
+
+err_t ws_dispatch_receive(struct tcp_pcb* tpcb, struct pbuf* p){
+    ws_dispatch_reclaim_work(NULL, NULL);
+    if (ws_dispatch_head - ws_dispatch_reclaim >= WS_DISPATCH_QUEUE_LEN) {
+        return ERR_MEM;
+    }
+
+    uint16_t credit = p->tot_len;
+    ws_client_id_t client = ws_client_id(tpcb);
+
+    // Frames split across a pbuf chain are made contiguous once; single pbufs
+    // are parsed and unmasked in place
+    struct pbuf* frame = p;
+    if (p->next) {
+        frame = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+        if (!frame) return ERR_MEM;
+        pbuf_free(p);
+    }
+
+    ws_packet_header_t hdr;
+    if (ws_parse_packet(&hdr, frame->payload, frame->len) != WS_PARSE_SUCCESS) {
+        ws_client_recved(client, credit);
+        pbuf_free(frame);
+        return ERR_OK;
+    }
+
+    ws_dispatch_item_t* item = &ws_dispatch_ring[ws_dispatch_head & WS_DISPATCH_MASK];
+    *item = (ws_dispatch_item_t){
+        .client = client,
+        .p = frame,
+        .msg = (uint8_t*)frame->payload + hdr.start,
+        .len = hdr.length,
+        .credit = credit
+    };
+    __dmb();
+    ws_dispatch_head++;
+
+    // Wake an application loop sleeping in __wfe()
+    __sev();
+    return ERR_OK;
+}
+
+void ws_dispatch_set_consumer_core(int core){
+    ws_dispatch_consumer = core;
+}
+
+bool ws_dispatch_poll(void){
+    if (ws_dispatch_consumer >= 0 && (int)get_core_num() != ws_dispatch_consumer) return false;
+
+    uint32_t tail = ws_dispatch_tail;
+    if (tail == ws_dispatch_head) return false;
+    __dmb();
+
+    ws_dispatch_item_t* item = &ws_dispatch_ring[tail & WS_DISPATCH_MASK];
+    // Only the id is handed over: the handler resolves it under the lwIP
+    // lock, so a client closing meanwhile is never used after lwIP frees it
+    if (ws_dispatch_on_text) ws_dispatch_on_text(item->client, item->msg, item->len);
+
+    __dmb();
+    ws_dispatch_tail = tail + 1;
+    ws_dispatch_total++;
+    async_context_set_work_pending(cyw43_arch_async_context(), &ws_dispatch_reclaim_worker);
+    return true;
+}
+
+size_t ws_dispatch_drain(size_t max){
+    size_t count = 0;
+    while ((max == 0 || count < max) && ws_dispatch_poll()) {
+        count++;
+    }
+    return count;
+}
+
+size_t ws_dispatch_pending(void){
+    return ws_dispatch_head - ws_dispatch_tail;
+}
+
+uint32_t ws_dispatch_count(void){
+    return ws_dispatch_total;
+}
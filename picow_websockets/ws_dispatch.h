@@ -0,0 +1,114 @@
+#ifndef WS_DISPATCH_H
+#define WS_DISPATCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "websocket.h"
+
+/**
+ * @brief Number of text messages that can wait for the application.
+ *        Must be a power of two.
+ */
+#ifndef WS_DISPATCH_QUEUE_LEN
+#define WS_DISPATCH_QUEUE_LEN 8
+#endif
+
+/**
+ * @enum WS_DISPATCH_MODE
+ * @brief Where text messages are handled.
+ */
+typedef enum {
+    WS_DISPATCH_INLINE   = 0, /**< Inside the lwIP receive callback (default). */
+    WS_DISPATCH_DEFERRED = 1  /**< From ws_dispatch_poll()/ws_dispatch_drain() in the application loop. */
+} WS_DISPATCH_MODE;
+
+/**
+ * @struct ws_dispatch_item_t
+ * @brief A received text message waiting for its handler.
+ *
+ * The message points straight into the received pbuf, which is held until
+ * the handler has run; its TCP window credit is returned only then (through
+ * the governor, like inline messages), so a slow application throttles its
+ * peers instead of buffering.
+ */
+typedef struct {
+    ws_client_id_t client; /**< Sender; resolves to nothing once it is gone. */
+    struct pbuf*   p;      /**< pbuf holding the message. */
+    uint8_t*       msg;    /**< Unmasked payload inside `p`. */
+    size_t         len;    /**< Payload length. */
+    uint16_t       credit; /**< Bytes to pass to tcp_recved() once handled. */
+} ws_dispatch_item_t;
+
+/**
+ * @typedef ws_dispatch_handler
+ * @brief Handler of deferred text messages.
+ *
+ * It runs outside the lwIP context, possibly on core1, while lwIP may free
+ * the sender's PCB at any time, so it gets the sender's id rather than its
+ * PCB. Reply with ws_post_message() (ws_send_queue.h); ws_client_get_ip()
+ * and ws_client_get_route() take the lwIP lock themselves, and anything else
+ * must call ws_client_resolve() and use the PCB under cyw43_arch_lwip_begin().
+ * @param client Sender.
+ * @param msg    Payload, valid until the handler returns.
+ * @param len    Payload length.
+ */
+typedef void(*ws_dispatch_handler)(ws_client_id_t client, uint8_t* msg, size_t len);
+
+/**
+ * @brief Select inline or deferred dispatch. Call once at startup.
+ *
+ * In inline mode text messages go to the on_text handler, in the lwIP
+ * context. In deferred mode they go to the handler set with
+ * ws_set_dispatch_handler() instead, from the application loop or core1.
+ */
+void ws_set_dispatch_mode(WS_DISPATCH_MODE mode);
+
+/**
+ * @brief Set the handler of deferred text messages. Without one they are
+ *        discarded.
+ */
+void ws_set_dispatch_handler(ws_dispatch_handler handler);
+
+/**
+ * @brief Current dispatch mode.
+ */
+WS_DISPATCH_MODE ws_get_dispatch_mode(void);
+
+/**
+ * @brief Run the handler of the oldest queued message, if any.
+ * @return true if a message was dispatched.
+ */
+bool ws_dispatch_poll(void);
+
+/**
+ * @brief Dispatch up to `max` queued messages (0 for all).
+ * @return Number of messages dispatched.
+ */
+size_t ws_dispatch_drain(size_t max);
+
+/**
+ * @brief Number of messages waiting to be dispatched.
+ */
+size_t ws_dispatch_pending(void);
+
+/**
+ * @brief Total number of messages dispatched since boot.
+ */
+uint32_t ws_dispatch_count(void);
+
+/**
+ * @brief Restrict ws_dispatch_poll() to one core, keeping the ring
+ *        single-consumer. Set by ws_core1_worker_start().
+ * @param core Core number, or -1 to allow any (default).
+ */
+void ws_dispatch_set_consumer_core(int core);
+
+/**
+ * @brief Queue a received text frame. Called by the library from lwIP context.
+ * @return ERR_MEM with `p` untouched if the queue is full (lwIP redelivers it
+ *         later), ERR_OK otherwise.
+ */
+err_t ws_dispatch_receive(struct tcp_pcb* tpcb, struct pbuf* p);
+
+#endif /* WS_DISPATCH_H */
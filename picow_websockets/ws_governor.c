@@ -0,0 +1,101 @@
+#include "lwip/stats.h"
+#include "ws_governor.h"
+#include "websocket.h"
+
+#define WS_GOV_MAX_WITHHELD (TCP_WND / 2)
+
+static uint8_t ws_gov_pressure_pct = WS_GOV_PRESSURE_PCT;
+static uint8_t ws_gov_critical_pct = WS_GOV_CRITICAL_PCT;
+static uint32_t ws_gov_rejected = 0;
+static uint32_t ws_gov_deferred = 0;
+
+static const char ws_gov_unavailable[] = WS_GOV_UNAVAILABLE_RESPONSE;
+
+static uint8_t ws_gov_pct(size_t used, size_t avail){
+    if (avail == 0) return 0;
+    size_t pct = (used * 100) / avail;
+    return pct > 100 ? 100 : (uint8_t)pct;
+}
+
+void ws_governor_set_watermarks(uint8_t pressure_pct, uint8_t critical_pct){
+    ws_gov_pressure_pct = pressure_pct;
+    ws_gov_critical_pct = critical_pct;
+}
+
+void ws_governor_status(ws_governor_status_t* status){
+    memset(status, 0, sizeof(*status));
+
+#if MEM_STATS
+    status->heap_pct = ws_gov_pct(lwip_stats.mem.used, lwip_stats.mem.avail);
+#endif
+#if MEMP_STATS
+    status->pbuf_pct = ws_gov_pct(lwip_stats.memp[MEMP_PBUF_POOL]->used, lwip_stats.memp[MEMP_PBUF_POOL]->avail);
+    status->pcb_pct  = ws_gov_pct(lwip_stats.memp[MEMP_TCP_PCB]->used, lwip_stats.memp[MEMP_TCP_PCB]->avail);
+#endif
+
+    ws_memory_stats_t mem;
+    ws_get_memory_stats(&mem);
+    status->clients_pct = ws_gov_pct(mem.clients.in_use, mem.clients.capacity);
+    status->routes_pct  = ws_gov_pct(mem.routes.in_use, mem.routes.capacity);
+
+    /* Only memory drives the level. PCBs (TIME_WAIT ones included), client
+     * slots and routes are small pools that already refuse what does not
+     * fit; a few busy slots say nothing about the heap. */
+    uint8_t worst = status->heap_pct;
+    if (status->pbuf_pct > worst)    worst = status->pbuf_pct;
+
+    if (worst >= ws_gov_critical_pct)      status->level = WS_GOV_CRITICAL;
+    else if (worst >= ws_gov_pressure_pct) status->level = WS_GOV_PRESSURE;
+    else                                   status->level = WS_GOV_NORMAL;
+
+    status->rejected = ws_gov_rejected;
+    status->deferred = ws_gov_deferred;
+}
+
+WS_GOV_LEVEL ws_governor_level(void){
+    ws_governor_status_t status;
+    ws_governor_status(&status);
+    return status.level;
+}
+
+bool ws_governor_admit(void){
+    if (ws_governor_level() >= WS_GOV_CRITICAL) {
+        ws_gov_rejected++;
+        return false;
+    }
+    return true;
+}
+
+bool ws_governor_allow_broadcast(void){
+    if (ws_governor_level() >= WS_GOV_PRESSURE) {
+        ws_gov_deferred++;
+        return false;
+    }
+    return true;
+}
+
+err_t ws_governor_reject(struct tcp_pcb* tpcb){
+    tcp_recv(tpcb, NULL);
+    tcp_write(tpcb, ws_gov_unavailable, sizeof(ws_gov_unavailable) - 1, 0);
+    tcp_output(tpcb);
+    if (tcp_close(tpcb) != ERR_OK) {
+        tcp_abort(tpcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+uint16_t ws_governor_recv_credit(uint16_t* withheld, uint16_t len){
+    if (ws_governor_level() == WS_GOV_NORMAL) {
+        uint16_t credit = len + *withheld;
+        *withheld = 0;
+        return credit;
+    }
+
+    uint16_t hold = len / 2;
+    if (*withheld + hold > WS_GOV_MAX_WITHHELD) {
+        hold = *withheld < WS_GOV_MAX_WITHHELD ? WS_GOV_MAX_WITHHELD - *withheld : 0;
+    }
+    *withheld += hold;
+    return len - hold;
+}
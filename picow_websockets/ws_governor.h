@@ -0,0 +1,104 @@
+#ifndef WS_GOVERNOR_H
+#define WS_GOVERNOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <lwip/tcp.h>
+
+#ifndef WS_GOV_PRESSURE_PCT
+#define WS_GOV_PRESSURE_PCT 70   /**< Memory utilization at which non-critical work is shed. */
+#endif
+
+#ifndef WS_GOV_CRITICAL_PCT
+#define WS_GOV_CRITICAL_PCT 85   /**< Memory utilization at which new connections are refused. */
+#endif
+
+#define WS_GOV_RETRY_AFTER_S "5"
+
+/**
+ * @brief Response sent to connections and upgrades refused by the governor.
+ */
+#define WS_GOV_UNAVAILABLE_RESPONSE \
+    "HTTP/1.1 503 Service Unavailable\r\n" \
+    "Retry-After: " WS_GOV_RETRY_AFTER_S "\r\n" \
+    "Connection: close\r\n" \
+    "Content-Length: 0\r\n" \
+    "\r\n"
+
+/**
+ * @enum WS_GOV_LEVEL
+ * @brief Memory pressure level, derived from the fuller of the lwIP heap and PBUF_POOL.
+ */
+typedef enum {
+    WS_GOV_NORMAL   = 0, /**< Everything is admitted. */
+    WS_GOV_PRESSURE = 1, /**< Non-critical broadcasts deferred, receive windows shrunk. */
+    WS_GOV_CRITICAL = 2  /**< New connections and upgrades refused with 503. */
+} WS_GOV_LEVEL;
+
+/**
+ * @struct ws_governor_status_t
+ * @brief Utilization of every tracked resource, in percent.
+ *
+ * Only heap_pct and pbuf_pct set the level; the other values are reported
+ * for diagnostics, their pools enforcing their own caps.
+ */
+typedef struct {
+    uint8_t      heap_pct;    /**< lwIP heap (MEM_SIZE). */
+    uint8_t      pbuf_pct;    /**< PBUF_POOL. */
+    uint8_t      pcb_pct;     /**< TCP PCBs in use, TIME_WAIT included. */
+    uint8_t      clients_pct; /**< WebSocket client slots. */
+    uint8_t      routes_pct;  /**< WebSocket route pool. */
+    WS_GOV_LEVEL level;       /**< Level derived from the values above. */
+    uint32_t     rejected;    /**< Connections and upgrades refused so far. */
+    uint32_t     deferred;    /**< Broadcasts postponed so far. */
+} ws_governor_status_t;
+
+/**
+ * @brief Change the pressure and critical watermarks at runtime.
+ * @param pressure_pct Utilization entering WS_GOV_PRESSURE.
+ * @param critical_pct Utilization entering WS_GOV_CRITICAL.
+ */
+void ws_governor_set_watermarks(uint8_t pressure_pct, uint8_t critical_pct);
+
+/**
+ * @brief Current pressure level. Reads lwIP counters, so call from lwIP context.
+ */
+WS_GOV_LEVEL ws_governor_level(void);
+
+/**
+ * @brief Fill `status` with the utilization of every tracked resource.
+ */
+void ws_governor_status(ws_governor_status_t* status);
+
+/**
+ * @brief Decide whether a new connection or upgrade may proceed.
+ * @return false (and counts a rejection) at WS_GOV_CRITICAL.
+ */
+bool ws_governor_admit(void);
+
+/**
+ * @brief Decide whether a non-critical broadcast should go out now.
+ * @return false (and counts a deferral) at WS_GOV_PRESSURE or above.
+ */
+bool ws_governor_allow_broadcast(void);
+
+/**
+ * @brief Refuse a connection with WS_GOV_UNAVAILABLE_RESPONSE and close it.
+ * @return ERR_OK, or ERR_ABRT if the PCB had to be aborted instead (return it
+ *         from the lwIP callback in that case).
+ */
+err_t ws_governor_reject(struct tcp_pcb* tpcb);
+
+/**
+ * @brief Portion of `len` received bytes to acknowledge with tcp_recved().
+ *
+ * Under pressure only half is credited, shrinking the advertised window,
+ * and the rest is added to `withheld`. Once pressure is gone the withheld
+ * credit is returned as well.
+ * @param withheld Per-connection counter of credit not yet returned.
+ * @param len      Bytes just received (0 to only settle withheld credit).
+ * @return Number of bytes to pass to tcp_recved().
+ */
+uint16_t ws_governor_recv_credit(uint16_t* withheld, uint16_t len);
+
+#endif /* WS_GOVERNOR_H */
@@ -0,0 +1,34 @@
+#include "pico/cyw43_arch.h"
+#include "ws_loop.h"
+#include "ws_dispatch.h"
+#include "ws_core1.h"
+#include "ws_timer.h"
+
+static ws_loop_stats_t ws_loop_stats = {0};
+
+void ws_loop_run_once(absolute_time_t deadline){
+    ws_loop_stats.iterations++;
+
+    bool dispatch_here = ws_get_dispatch_mode() == WS_DISPATCH_DEFERRED && !ws_core1_worker_running();
+    if (dispatch_here) {
+        ws_loop_stats.messages += ws_dispatch_drain(0);
+    }
+
+    ws_timer_run();
+
+    // Only poll-based architectures need this; it is a no-op in background mode
+    cyw43_arch_poll();
+
+    absolute_time_t next_timer = ws_timer_next_deadline();
+    if (absolute_time_diff_us(next_timer, deadline) > 0) deadline = next_timer;
+
+    if (dispatch_here && ws_dispatch_pending()) return;
+    if (time_reached(deadline)) return;
+
+    ws_loop_stats.sleeps++;
+    cyw43_arch_wait_for_work_until(deadline);
+}
+
+void ws_loop_get_stats(ws_loop_stats_t* stats){
+    *stats = ws_loop_stats;
+}
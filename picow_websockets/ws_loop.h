@@ -0,0 +1,37 @@
+#ifndef WS_LOOP_H
+#define WS_LOOP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/**
+ * @struct ws_loop_stats_t
+ * @brief Counters of the application event loop.
+ */
+typedef struct {
+    uint32_t iterations; /**< Calls to ws_loop_run_once(). */
+    uint32_t sleeps;     /**< Times the loop actually went to sleep. */
+    uint32_t messages;   /**< Deferred messages dispatched by the loop. */
+} ws_loop_stats_t;
+
+/**
+ * @brief Run one iteration of the application event loop.
+ *
+ * Dispatches deferred messages (unless core1 owns dispatch), fires due
+ * ws_timer_t timers, then sleeps until lwIP/cyw43 signals new work, the next
+ * timer is due or `deadline` passes, whichever comes first.
+ *
+ * Replaces polling with a fixed sleep_ms(), which added up to a whole sleep
+ * period of latency to every application-driven send.
+ * @param deadline When the caller's next timed work is due
+ *                 (at_the_end_of_time if none).
+ */
+void ws_loop_run_once(absolute_time_t deadline);
+
+/**
+ * @brief Snapshot the loop counters.
+ */
+void ws_loop_get_stats(ws_loop_stats_t* stats);
+
+#endif /* WS_LOOP_H */
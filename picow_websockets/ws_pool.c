@@ -0,0 +1,47 @@
+#include "ws_pool.h"
+
+static void ws_pool_count_alloc(ws_pool_stats_t* stats, size_t amount){
+    stats->in_use += amount;
+    if (stats->in_use > stats->peak) stats->peak = stats->in_use;
+}
+
+void* ws_pool_alloc(ws_pool_t* pool){
+    void* block;
+
+    if (pool->free_list) {
+        block = pool->free_list;
+        pool->free_list = *(void**)block;
+    } else if (pool->unused < pool->stats.capacity) {
+        block = pool->storage + pool->unused * pool->block_size;
+        pool->unused++;
+    } else {
+        pool->stats.failures++;
+        return NULL;
+    }
+
+    ws_pool_count_alloc(&pool->stats, 1);
+    return block;
+}
+
+void ws_pool_free(ws_pool_t* pool, void* block){
+    if (!block) return;
+    *(void**)block = pool->free_list;
+    pool->free_list = block;
+    pool->stats.in_use--;
+}
+
+void* ws_arena_alloc(ws_arena_t* arena, size_t size){
+    size = WS_POOL_ALIGN(size);
+    if (arena->stats.capacity - arena->stats.in_use < size) {
+        arena->stats.failures++;
+        return NULL;
+    }
+
+    void* mem = arena->buf + arena->stats.in_use;
+    ws_pool_count_alloc(&arena->stats, size);
+    return mem;
+}
+
+void ws_arena_reset(ws_arena_t* arena){
+    arena->stats.in_use = 0;
+}
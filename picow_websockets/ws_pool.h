@@ -0,0 +1,88 @@
+#ifndef WS_POOL_H
+#define WS_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @struct ws_pool_stats_t
+ * @brief Usage counters shared by pools, arenas and slot tables.
+ */
+typedef struct {
+    size_t   capacity; /**< Blocks (pools, slots) or bytes (arenas) available. */
+    size_t   in_use;   /**< Blocks or bytes currently allocated. */
+    size_t   peak;     /**< Highest value `in_use` has reached. */
+    uint32_t failures; /**< Allocations refused because the pool was exhausted. */
+} ws_pool_stats_t;
+
+/**
+ * @struct ws_pool_t
+ * @brief Fixed-size block pool over static storage.
+ *
+ * Blocks are handed out from a free list, falling back to never-used blocks,
+ * so a statically initialized pool needs no init call.
+ */
+typedef struct {
+    uint8_t*        storage;    /**< Backing storage, block_size * stats.capacity bytes. */
+    size_t          block_size; /**< Size of each block, multiple of sizeof(void*). */
+    size_t          unused;     /**< Index of the first never-allocated block. */
+    void*           free_list;  /**< Released blocks, linked through their first word. */
+    ws_pool_stats_t stats;      /**< Usage counters. */
+} ws_pool_t;
+
+/**
+ * @struct ws_arena_t
+ * @brief Bump allocator for per-message scratch memory, released all at once.
+ */
+typedef struct {
+    uint8_t*        buf;   /**< Backing storage. */
+    ws_pool_stats_t stats; /**< stats.in_use is the number of bytes handed out. */
+} ws_arena_t;
+
+#define WS_POOL_ALIGN(size) (((size) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+/**
+ * @brief Define a static pool named `name` with `count` blocks of `size` bytes.
+ */
+#define WS_POOL_DEFINE(name, size, count)                                          \
+    static void* name##_storage[(WS_POOL_ALIGN(size) * (count)) / sizeof(void*)];  \
+    static ws_pool_t name = {                                                      \
+        .storage = (uint8_t*)name##_storage,                                       \
+        .block_size = WS_POOL_ALIGN(size),                                         \
+        .stats = { .capacity = (count) }                                           \
+    }
+
+/**
+ * @brief Define a static arena named `name` holding `size` bytes.
+ */
+#define WS_ARENA_DEFINE(name, size)                                                \
+    static void* name##_storage[WS_POOL_ALIGN(size) / sizeof(void*)];              \
+    static ws_arena_t name = {                                                     \
+        .buf = (uint8_t*)name##_storage,                                           \
+        .stats = { .capacity = WS_POOL_ALIGN(size) }                               \
+    }
+
+/**
+ * @brief Take one block from the pool.
+ * @return Pointer to the block, or NULL if the pool is exhausted.
+ */
+void* ws_pool_alloc(ws_pool_t* pool);
+
+/**
+ * @brief Return a block to the pool. NULL is ignored.
+ */
+void ws_pool_free(ws_pool_t* pool, void* block);
+
+/**
+ * @brief Allocate `size` bytes (pointer-aligned) from the arena.
+ * @return Pointer to the memory, or NULL if the arena is exhausted.
+ */
+void* ws_arena_alloc(ws_arena_t* arena, size_t size);
+
+/**
+ * @brief Release everything allocated from the arena.
+ */
+void ws_arena_reset(ws_arena_t* arena);
+
+#endif /* WS_POOL_H */
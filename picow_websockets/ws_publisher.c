@@ -0,0 +1,61 @@
+#include "pico/cyw43_arch.h"
+#include "ws_publisher.h"
+#include "ws_send_queue.h"
+#include "ws_governor.h"
+#include "ws_timer.h"
+
+typedef struct {
+    const char*     route;
+    ws_publisher_fn produce;
+    ws_timer_t      timer;
+} ws_publisher_t;
+
+static ws_publisher_t ws_publishers[WS_PUBLISHER_MAX];
+static size_t ws_publisher_count = 0;
+static ws_publisher_stats_t ws_publisher_stats = {0};
+
+static void ws_publisher_fire(ws_timer_t* timer, void* arg){
+    ws_publisher_t* pub = arg;
+
+    cyw43_arch_lwip_begin();
+    bool subscribed = ws_route_has_clients(pub->route);
+    bool allowed = ws_governor_allow_broadcast();
+    cyw43_arch_lwip_end();
+
+    if (!subscribed) {
+        ws_publisher_stats.idle++;
+        return;
+    }
+    if (!allowed) {
+        ws_publisher_stats.deferred++;
+        return;
+    }
+
+    size_t capacity;
+    uint8_t* payload = ws_post_begin(&capacity);
+    if (!payload) {
+        ws_publisher_stats.deferred++;
+        return;
+    }
+
+    WS_OPCODE opcode = WS_OP_TEXT;
+    size_t len = pub->produce(pub->route, payload, capacity, &opcode);
+    if (len == 0 || len > capacity) return;
+
+    if (ws_post_commit_to_all_clients(pub->route, opcode, len)) ws_publisher_stats.published++;
+}
+
+bool ws_publisher_register(const char* route, uint32_t period_ms, ws_publisher_fn produce){
+    if (ws_publisher_count >= WS_PUBLISHER_MAX || !produce || period_ms == 0) return false;
+
+    ws_publisher_t* pub = &ws_publishers[ws_publisher_count++];
+    pub->route = route;
+    pub->produce = produce;
+    ws_timer_init(&pub->timer, ws_publisher_fire, pub);
+    ws_timer_start_aligned(&pub->timer, period_ms);
+    return true;
+}
+
+void ws_publisher_get_stats(ws_publisher_stats_t* stats){
+    *stats = ws_publisher_stats;
+}
@@ -0,0 +1,59 @@
+#ifndef WS_PUBLISHER_H
+#define WS_PUBLISHER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "websocket.h"
+
+#ifndef WS_PUBLISHER_MAX
+#define WS_PUBLISHER_MAX 4
+#endif
+
+/**
+ * @typedef ws_publisher_fn
+ * @brief Producer of a periodic message. Writes the payload into `buf`.
+ * @param route    Route being published.
+ * @param buf      Payload area, encoded in place and sent as is.
+ * @param capacity Bytes available in `buf`.
+ * @param opcode   Frame opcode, WS_OP_TEXT unless the producer changes it.
+ * @return Payload length, 0 to skip this period.
+ */
+typedef size_t(*ws_publisher_fn)(const char* route, uint8_t* buf, size_t capacity, WS_OPCODE* opcode);
+
+/**
+ * @struct ws_publisher_stats_t
+ * @brief Counters shared by all publishers.
+ */
+typedef struct {
+    uint32_t published; /**< Messages produced and queued. */
+    uint32_t idle;      /**< Periods skipped because the route had no clients. */
+    uint32_t deferred;  /**< Periods skipped under memory pressure or a full queue. */
+} ws_publisher_stats_t;
+
+/*
+ * Publishers run from ws_loop_run_once() on the application loop. Each period
+ * the route is checked for subscribers first: with nobody connected the
+ * producer is not called, so an idle device formats and sends nothing. The
+ * payload is encoded once, straight into an outbound queue slot, and goes to
+ * every client through the shared broadcast path.
+ *
+ * Periods are aligned to multiples of themselves since boot, so publishers
+ * with the same (or harmonic) periods fire in the same wakeup.
+ */
+
+/**
+ * @brief Register a periodic publisher.
+ * @param route     Route whose clients receive the messages (must outlive the publisher).
+ * @param period_ms Publishing interval.
+ * @param produce   Producer, called only while the route has clients.
+ * @return false if the publisher table is full.
+ */
+bool ws_publisher_register(const char* route, uint32_t period_ms, ws_publisher_fn produce);
+
+/**
+ * @brief Snapshot the publisher counters.
+ */
+void ws_publisher_get_stats(ws_publisher_stats_t* stats);
+
+#endif /* WS_PUBLISHER_H */
@@ -0,0 +1,179 @@
+#include "pico/cyw43_arch.h"
+#include "hardware/sync.h"
+#include "ws_send_queue.h"
+
+#define WS_SEND_QUEUE_MASK (WS_SEND_QUEUE_LEN - 1)
+
+extern ws_connected_clients_t* ws_connected_clients;
+
+typedef struct {
+    ws_client_id_t client;                  /**< Target client, WS_CLIENT_ID_NONE for a broadcast. */
+    char           route[WS_ROUTE_MAX_LEN]; /**< Broadcast route. */
+    WS_OPCODE      opcode;
+    uint16_t       len;
+    uint8_t        frame[WS_FRAME_HEADER_MAX + WS_SEND_QUEUE_SLOT_SIZE];
+} ws_send_slot_t;
+
+typedef struct {
+    ws_send_slot_t    slots[WS_SEND_QUEUE_LEN];
+    volatile uint32_t head; /**< Written by the owning core only. */
+    volatile uint32_t tail; /**< Written by the drain worker only. */
+    uint32_t          posted;
+    uint32_t          dropped;
+} ws_send_ring_t;
+
+static ws_send_ring_t ws_send_rings[WS_SEND_QUEUE_PRODUCERS];
+static uint32_t ws_send_sent = 0;
+static uint32_t ws_send_stale = 0;
+static uint32_t ws_send_failed = 0;
+static volatile bool ws_send_worker_added = false;
+static bool ws_send_retry_armed = false;
+
+static void ws_send_queue_drain(async_context_t *context, async_when_pending_worker_t *worker);
+static async_when_pending_worker_t ws_send_worker = {.do_work = ws_send_queue_drain};
+
+static void ws_send_queue_retry(async_context_t *context, async_at_time_worker_t *worker){
+    ws_send_retry_armed = false;
+    async_context_set_work_pending(context, &ws_send_worker);
+}
+static async_at_time_worker_t ws_send_retry_worker = {.do_work = ws_send_queue_retry};
+
+// Writes queued messages to lwIP until the rings are empty or lwIP is out of
+// send buffer, then flushes each client once. A message lwIP had no room for
+// stays at the tail of its ring and the drain runs again a little later.
+static void ws_send_queue_drain(async_context_t *context, async_when_pending_worker_t *worker){
+    bool wrote = false;
+    bool blocked = false;
+
+    for (int r = 0; r < WS_SEND_QUEUE_PRODUCERS && !blocked; r++) {
+        ws_send_ring_t* ring = &ws_send_rings[r];
+        uint32_t head = ring->head;
+        __dmb();
+
+        while (ring->tail != head) {
+            ws_send_slot_t* slot = &ring->slots[ring->tail & WS_SEND_QUEUE_MASK];
+            packet_length frame_len;
+            uint8_t* frame = ws_frame_wrap(slot->frame + WS_FRAME_HEADER_MAX, slot->opcode, slot->len, &frame_len);
+
+            ws_client_tpcb tpcb;
+            if (slot->client.slot == WS_CLIENT_ID_NONE.slot) {
+                // Some clients may already have their copy, so a broadcast is not retried
+                ws_send_failed += ws_send_frame_to_all_clients(slot->route, frame, frame_len);
+                ws_send_sent++;
+            } else if (!(tpcb = ws_client_resolve(slot->client))) {
+                ws_send_stale++;
+            } else {
+                err_t err = tcp_write(tpcb, frame, frame_len, TCP_WRITE_FLAG_COPY);
+                if (err == ERR_MEM) {
+                    blocked = true;
+                    break;
+                }
+                if (err == ERR_OK) ws_send_sent++;
+                else ws_send_failed++;
+            }
+
+            __dmb();
+            ring->tail++;
+            wrote = true;
+        }
+    }
+
+    if (blocked && !ws_send_retry_armed) {
+        ws_send_retry_armed = true;
+        async_context_add_at_time_worker_in_ms(context, &ws_send_retry_worker, WS_SEND_QUEUE_RETRY_MS);
+    }
+
+    if (!wrote && !blocked) return;
+    for (size_t ii = 0; ii < ws_connected_clients->count; ii++) {
+        if (ws_connected_clients->items[ii].tpcb) tcp_output(ws_connected_clients->items[ii].tpcb);
+    }
+}
+
+static void ws_send_queue_add_worker(void){
+    if (ws_send_worker_added) return;
+    cyw43_arch_lwip_begin();
+    if (!ws_send_worker_added) {
+        async_context_add_when_pending_worker(cyw43_arch_async_context(), &ws_send_worker);
+        ws_send_worker_added = true;
+    }
+    cyw43_arch_lwip_end();
+}
+
+uint8_t* ws_post_begin(size_t* capacity){
+    ws_send_queue_add_worker();
+
+    ws_send_ring_t* ring = &ws_send_rings[get_core_num()];
+    if (ring->head - ring->tail >= WS_SEND_QUEUE_LEN) {
+        ring->dropped++;
+        return NULL;
+    }
+
+    *capacity = WS_SEND_QUEUE_SLOT_SIZE;
+    return ring->slots[ring->head & WS_SEND_QUEUE_MASK].frame + WS_FRAME_HEADER_MAX;
+}
+
+static bool ws_post_commit(ws_client_id_t client, const char* route, WS_OPCODE opcode, size_t len){
+    ws_send_ring_t* ring = &ws_send_rings[get_core_num()];
+    if (ring->head - ring->tail >= WS_SEND_QUEUE_LEN || len > WS_SEND_QUEUE_SLOT_SIZE ||
+        (route && strlen(route) >= WS_ROUTE_MAX_LEN)) {
+        ring->dropped++;
+        return false;
+    }
+
+    ws_send_slot_t* slot = &ring->slots[ring->head & WS_SEND_QUEUE_MASK];
+    slot->client = client;
+    slot->route[0] = '\0';
+    if (route) strcpy(slot->route, route);
+    slot->opcode = opcode;
+    slot->len = len;
+
+    __dmb();
+    ring->head++;
+    ring->posted++;
+
+    async_context_set_work_pending(cyw43_arch_async_context(), &ws_send_worker);
+    return true;
+}
+
+bool ws_post_commit_message(ws_client_id_t client, WS_OPCODE opcode, size_t len){
+    if (client.slot == WS_CLIENT_ID_NONE.slot) {
+        ws_send_rings[get_core_num()].dropped++;
+        return false;
+    }
+    return ws_post_commit(client, NULL, opcode, len);
+}
+
+bool ws_post_commit_to_all_clients(const char* route, WS_OPCODE opcode, size_t len){
+    return ws_post_commit(WS_CLIENT_ID_NONE, route, opcode, len);
+}
+
+static bool ws_post(ws_client_id_t client, const char* route, WS_OPCODE opcode, const uint8_t* msg, size_t len){
+    size_t capacity;
+    uint8_t* payload = ws_post_begin(&capacity);
+    if (!payload) return false;
+    if (len > capacity) {
+        ws_send_rings[get_core_num()].dropped++;
+        return false;
+    }
+    memcpy(payload, msg, len);
+    return route ? ws_post_commit_to_all_clients(route, opcode, len) : ws_post_commit_message(client, opcode, len);
+}
+
+bool ws_post_message(ws_client_id_t client, WS_OPCODE opcode, const uint8_t* msg, size_t len){
+    return ws_post(client, NULL, opcode, msg, len);
+}
+
+bool ws_post_to_all_clients(const char* route, WS_OPCODE opcode, const uint8_t* msg, size_t len){
+    return ws_post(WS_CLIENT_ID_NONE, route, opcode, msg, len);
+}
+
+void ws_send_queue_get_stats(ws_send_queue_stats_t* stats){
+    memset(stats, 0, sizeof(*stats));
+    for (int r = 0; r < WS_SEND_QUEUE_PRODUCERS; r++) {
+        stats->posted += ws_send_rings[r].posted;
+        stats->dropped += ws_send_rings[r].dropped;
+    }
+    stats->sent = ws_send_sent;
+    stats->stale = ws_send_stale;
+    stats->failed = ws_send_failed;
+}
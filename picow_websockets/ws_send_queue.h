@@ -0,0 +1,99 @@
+#ifndef WS_SEND_QUEUE_H
+#define WS_SEND_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "websocket.h"
+
+/**
+ * @brief Slots per producer ring. Must be a power of two.
+ */
+#ifndef WS_SEND_QUEUE_LEN
+#define WS_SEND_QUEUE_LEN 8
+#endif
+
+/**
+ * @brief Largest payload a queued message can carry.
+ */
+#ifndef WS_SEND_QUEUE_SLOT_SIZE
+#define WS_SEND_QUEUE_SLOT_SIZE 256
+#endif
+
+/**
+ * @brief Delay before draining again after lwIP ran out of send buffer.
+ */
+#ifndef WS_SEND_QUEUE_RETRY_MS
+#define WS_SEND_QUEUE_RETRY_MS 10
+#endif
+
+/**
+ * @brief One ring per core, so each ring has a single producer.
+ */
+#define WS_SEND_QUEUE_PRODUCERS 2
+
+/**
+ * @struct ws_send_queue_stats_t
+ * @brief Counters of the outbound command queue.
+ */
+typedef struct {
+    uint32_t posted;  /**< Messages accepted by ws_post_*. */
+    uint32_t dropped; /**< Messages refused: ring full, too large, or no client given. */
+    uint32_t sent;    /**< Messages written to lwIP by the drain worker. */
+    uint32_t stale;   /**< Messages discarded because their client had gone. */
+    uint32_t failed;  /**< Client writes lwIP refused for good (refused broadcast copies included). */
+} ws_send_queue_stats_t;
+
+/*
+ * Outbound messages posted from outside the lwIP context (the application
+ * loop, core1) are copied into a lock-free single-producer ring owned by the
+ * calling core and written to lwIP in batches by an async_context worker.
+ * Posting never takes the lwIP lock and never blocks; if the ring is full the
+ * message is dropped and counted. When lwIP's send buffer is full the drain
+ * stops and the remaining messages wait for the next run.
+ *
+ * A message for one client is addressed by its ws_client_id_t, not its tpcb,
+ * so it is discarded rather than delivered to whoever reuses the slot or the
+ * pcb if the client goes before the message is drained.
+ *
+ * Each core may have one producer at a time: do not post from IRQ handlers
+ * that can preempt a post on the same core. Code already running in the lwIP
+ * context (inline handlers) should keep using ws_send_message().
+ */
+
+/**
+ * @brief Queue a message for one client.
+ * @return false if the message was dropped.
+ */
+bool ws_post_message(ws_client_id_t client, WS_OPCODE opcode, const uint8_t* msg, size_t len);
+
+/**
+ * @brief Queue a message for every client on `route`.
+ * @return false if the message was dropped.
+ */
+bool ws_post_to_all_clients(const char* route, WS_OPCODE opcode, const uint8_t* msg, size_t len);
+
+/**
+ * @brief Reserve the payload area of the calling core's next free slot, so a
+ *        message can be encoded in place. Finish with one ws_post_commit_*.
+ * @param capacity Receives the number of payload bytes available.
+ * @return Pointer to the payload area, or NULL if the ring is full.
+ */
+uint8_t* ws_post_begin(size_t* capacity);
+
+/**
+ * @brief Publish the slot reserved by ws_post_begin() to one client.
+ */
+bool ws_post_commit_message(ws_client_id_t client, WS_OPCODE opcode, size_t len);
+
+/**
+ * @brief Publish the slot reserved by ws_post_begin() to every client on `route`.
+ */
+bool ws_post_commit_to_all_clients(const char* route, WS_OPCODE opcode, size_t len);
+
+/**
+ * @brief Snapshot the queue counters.
+ */
+void ws_send_queue_get_stats(ws_send_queue_stats_t* stats);
+
+#endif /* WS_SEND_QUEUE_H */
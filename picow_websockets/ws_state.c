@@ -0,0 +1,200 @@
+#include "pico/cyw43_arch.h"
+#include "ws_state.h"
+#include "cbor.h"
+#include "ws_governor.h"
+#include "ws_timer.h"
+
+// The map count is patched into the map's initial byte once known
+#if WS_STATE_MAX_FIELDS >= 24
+#error "WS_STATE_MAX_FIELDS must be below 24"
+#endif
+
+// Frame bytes besides the fields: array head, version and map head
+#define WS_STATE_FRAME_OVERHEAD (1 + 5 + 1)
+
+static ws_state_t* ws_states = NULL;
+static ws_timer_t ws_state_timer;
+
+static void ws_state_fire(ws_timer_t* timer, void* arg){
+    ws_state_tick_all();
+}
+
+void ws_state_init(ws_state_t* st, const char* route){
+    memset(st, 0, sizeof(*st));
+    st->route = route;
+    st->next = ws_states;
+    ws_states = st;
+
+    if (!ws_timer_pending(&ws_state_timer)) {
+        ws_timer_init(&ws_state_timer, ws_state_fire, NULL);
+        ws_timer_start(&ws_state_timer, WS_STATE_TICK_MS, WS_STATE_TICK_MS);
+    }
+}
+
+// Whether `key` with a `value_len`-byte value fits in a frame by itself: a
+// field that does not would keep every later delta of the store pending
+static bool ws_state_fits(const char* key, size_t value_len){
+    size_t key_len = strlen(key);
+    size_t key_head = key_len < 24 ? 1 : key_len <= UINT8_MAX ? 2 : key_len <= UINT16_MAX ? 3 : 5;
+    return WS_STATE_FRAME_OVERHEAD + key_head + key_len + value_len <= WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX;
+}
+
+static ws_state_field_t* ws_state_field(ws_state_t* st, const char* key){
+    for (size_t i = 0; i < st->count; i++) {
+        if (st->fields[i].key == key || strcmp(st->fields[i].key, key) == 0) {
+            return &st->fields[i];
+        }
+    }
+    if (st->count >= WS_STATE_MAX_FIELDS) return NULL;
+
+    ws_state_field_t* field = &st->fields[st->count++];
+    field->key = key;
+    field->version = 0;
+    field->value_len = 0;
+    return field;
+}
+
+// Stores an encoded value, bumping the version only when the bytes differ.
+// Under the lwIP lock: snapshots are read from the upgrade path.
+static bool ws_state_commit(ws_state_t* st, const char* key, cbor_writer_t* w){
+    if (w->overflow || !ws_state_fits(key, w->len)) return false;
+
+    cyw43_arch_lwip_begin();
+    ws_state_field_t* field = ws_state_field(st, key);
+    if (!field) {
+        cyw43_arch_lwip_end();
+        return false;
+    }
+
+    if (field->value_len != w->len || memcmp(field->value, w->buf, w->len) != 0) {
+        memcpy(field->value, w->buf, w->len);
+        field->value_len = w->len;
+        field->version = ++st->version;
+    }
+    cyw43_arch_lwip_end();
+    return true;
+}
+
+bool ws_state_set_uint(ws_state_t* st, const char* key, uint64_t value){
+    uint8_t tmp[WS_STATE_VALUE_MAX];
+    cbor_writer_t w;
+    cbor_writer_init(&w, tmp, sizeof(tmp));
+    cbor_put_uint(&w, value);
+    return ws_state_commit(st, key, &w);
+}
+
+bool ws_state_set_int(ws_state_t* st, const char* key, int64_t value){
+    uint8_t tmp[WS_STATE_VALUE_MAX];
+    cbor_writer_t w;
+    cbor_writer_init(&w, tmp, sizeof(tmp));
+    cbor_put_int(&w, value);
+    return ws_state_commit(st, key, &w);
+}
+
+bool ws_state_set_float(ws_state_t* st, const char* key, float value){
+    uint8_t tmp[WS_STATE_VALUE_MAX];
+    cbor_writer_t w;
+    cbor_writer_init(&w, tmp, sizeof(tmp));
+    cbor_put_float(&w, value);
+    return ws_state_commit(st, key, &w);
+}
+
+bool ws_state_set_bool(ws_state_t* st, const char* key, bool value){
+    uint8_t tmp[WS_STATE_VALUE_MAX];
+    cbor_writer_t w;
+    cbor_writer_init(&w, tmp, sizeof(tmp));
+    cbor_put_bool(&w, value);
+    return ws_state_commit(st, key, &w);
+}
+
+bool ws_state_set_text(ws_state_t* st, const char* key, const char* text, size_t len){
+    uint8_t tmp[WS_STATE_VALUE_MAX];
+    cbor_writer_t w;
+    cbor_writer_init(&w, tmp, sizeof(tmp));
+    cbor_put_text(&w, text, len);
+    return ws_state_commit(st, key, &w);
+}
+
+// Encodes the fields newer than `since`, from field *next on, into the
+// outbound frame buffer until it is full. *next is left at the first field
+// not encoded; a return of 0 with *next < st->count means it fits no frame.
+static size_t ws_state_encode(ws_state_t* st, uint32_t since, size_t* next){
+    size_t i = *next;
+    while (i < st->count && st->fields[i].version <= since) i++;
+    *next = i;
+    if (i == st->count) return 0;
+
+    size_t capacity;
+    uint8_t* payload = ws_frame_begin(&capacity);
+    cbor_writer_t w;
+    cbor_writer_init(&w, payload, capacity);
+    cbor_put_array(&w, 2);
+    cbor_put_uint(&w, st->version);
+    size_t map_at = w.len;
+    cbor_put_map(&w, 0);
+    if (w.overflow) return 0;
+
+    size_t n = 0;
+    for (; i < st->count; i++) {
+        ws_state_field_t* field = &st->fields[i];
+        if (field->version <= since) continue;
+        size_t mark = w.len;
+        cbor_put_cstr(&w, field->key);
+        cbor_put_raw(&w, field->value, field->value_len);
+        if (w.overflow) {
+            w.len = mark;
+            break;
+        }
+        n++;
+    }
+    *next = i;
+    if (n == 0) return 0;
+
+    w.buf[map_at] |= n;
+    return w.len;
+}
+
+// Sends the fields newer than `since` in as many frames as they take, to `wc`
+// or, if it is NULL, to every client on the store's route
+static bool ws_state_send(ws_state_t* st, uint32_t since, ws_client_tpcb wc){
+    size_t next = 0;
+    while (next < st->count) {
+        size_t len = ws_state_encode(st, since, &next);
+        if (!len) return next == st->count;
+        if (wc) ws_frame_send(wc, WS_OP_BIN, len);
+        else ws_frame_send_to_all_clients(st->route, WS_OP_BIN, len);
+    }
+    return true;
+}
+
+void ws_state_tick(ws_state_t* st){
+    if (st->version == st->sent_version) return;
+
+    cyw43_arch_lwip_begin();
+    // Deltas accumulate while deferred and go out in the first tick after
+    if (!ws_governor_allow_broadcast()) {
+        cyw43_arch_lwip_end();
+        return;
+    }
+    // Nobody to deliver to: new subscribers get a snapshot at upgrade anyway.
+    // A send that fails keeps the delta pending rather than lost
+    if (ws_route_has_clients(st->route) && !ws_state_send(st, st->sent_version, NULL)) {
+        cyw43_arch_lwip_end();
+        return;
+    }
+    st->sent_version = st->version;
+    cyw43_arch_lwip_end();
+}
+
+void ws_state_tick_all(void){
+    for (ws_state_t* st = ws_states; st; st = st->next) {
+        ws_state_tick(st);
+    }
+}
+
+void ws_state_send_snapshots(ws_client_tpcb wc, const char* route){
+    for (ws_state_t* st = ws_states; st; st = st->next) {
+        if (strcmp(st->route, route) != 0) continue;
+        ws_state_send(st, 0, wc);
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef WS_STATE_H
+#define WS_STATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "websocket.h"
+
+#define WS_STATE_MAX_FIELDS 16
+#define WS_STATE_VALUE_MAX  24
+
+#ifndef WS_STATE_TICK_MS
+#define WS_STATE_TICK_MS 100
+#endif
+
+/**
+ * @struct ws_state_field_t
+ * @brief One key of a state store, holding its value already CBOR-encoded.
+ */
+typedef struct {
+    const char* key;                      /**< Field name (must outlive the store). */
+    uint32_t    version;                  /**< Store version of the last change. */
+    uint8_t     value_len;                /**< Length of the encoded value. */
+    uint8_t     value[WS_STATE_VALUE_MAX];/**< CBOR encoding of the value. */
+} ws_state_field_t;
+
+/**
+ * @struct ws_state_t
+ * @brief Versioned key/value store mirrored to every client of a route.
+ *
+ * Publishers update fields with the ws_state_set_* functions. Every
+ * WS_STATE_TICK_MS the timer wheel (run by ws_loop_run_once()) calls
+ * ws_state_tick(), which broadcasts, in one binary frame, only the fields
+ * that changed since the previous tick. Clients that upgrade on the store's
+ * route receive a full snapshot first. Both messages use the same CBOR layout:
+ *
+ *     [version, {key: value, ...}]
+ *
+ * When the fields do not fit in one frame they are split over several, each
+ * with the same version and a part of the map.
+ */
+typedef struct ws_state {
+    const char*       route;        /**< Route whose clients receive the state. */
+    uint32_t          version;      /**< Bumped on every effective change. */
+    uint32_t          sent_version; /**< Version covered by the last tick. */
+    size_t            count;        /**< Number of fields in use. */
+    ws_state_field_t  fields[WS_STATE_MAX_FIELDS];
+    struct ws_state*  next;         /**< Next registered store. */
+} ws_state_t;
+
+/**
+ * @brief Initialize a store and register it for snapshots on upgrade and
+ *        for the periodic tick.
+ * @param st    Store, usually a static object.
+ * @param route Route whose clients receive the state (e.g. "/status").
+ */
+void ws_state_init(ws_state_t* st, const char* route);
+
+/**
+ * @brief Set a field. Creates the field on first use; setting the value it
+ *        already holds is a no-op and generates no traffic.
+ *        Takes the lwIP lock, so it may be called from any context.
+ * @return false if the store is full, the value does not fit, or the key and
+ *         value together would not fit in one frame.
+ */
+bool ws_state_set_uint(ws_state_t* st, const char* key, uint64_t value);
+bool ws_state_set_int(ws_state_t* st, const char* key, int64_t value);
+bool ws_state_set_float(ws_state_t* st, const char* key, float value);
+bool ws_state_set_bool(ws_state_t* st, const char* key, bool value);
+bool ws_state_set_text(ws_state_t* st, const char* key, const char* text, size_t len);
+
+/**
+ * @brief Broadcast the fields changed since the last tick as one frame, or
+ *        several if they do not fit. The changes count as sent only once
+ *        every frame has been encoded.
+ *        Takes the lwIP lock, so it is meant to be called from the main loop;
+ *        registered stores are already ticked from the timer wheel.
+ */
+void ws_state_tick(ws_state_t* st);
+
+/**
+ * @brief Run ws_state_tick() on every registered store, e.g. to flush a
+ *        change without waiting for the next tick.
+ */
+void ws_state_tick_all(void);
+
+/**
+ * @brief Send every registered store bound to `route` to a newly upgraded
+ *        client. Called by the library from the upgrade path.
+ */
+void ws_state_send_snapshots(ws_client_tpcb wc, const char* route);
+
+#endif /* WS_STATE_H */
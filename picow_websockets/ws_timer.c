@@ -0,0 +1,185 @@
+#include "ws_timer.h"
+
+#define WS_TIMER_MASK  (WS_TIMER_SLOTS - 1)
+#define WS_TIMER_RANGE (1u << (WS_TIMER_SLOT_BITS * WS_TIMER_LEVELS))
+
+// Level n holds timers expiring within 64^(n+1) ticks; level 0 slots are
+// single ticks. Occupancy bits may be stale (set for an empty slot) and are
+// cleared lazily when the slot is visited.
+static ws_timer_t* ws_wheel[WS_TIMER_LEVELS][WS_TIMER_SLOTS];
+static uint64_t ws_wheel_used[WS_TIMER_LEVELS];
+
+static uint32_t ws_timer_now = 0;      // next tick to process
+static bool ws_timer_clock_set = false;
+static size_t ws_timer_count = 0;
+
+static uint32_t ws_timer_clock(void){
+    return (uint32_t)(to_us_since_boot(get_absolute_time()) / (WS_TIMER_TICK_MS * 1000u));
+}
+
+static void ws_timer_link(ws_timer_t* timer){
+    int32_t delta = (int32_t)(timer->expires - ws_timer_now);
+    if (delta < 0) {
+        delta = 0;
+        timer->expires = ws_timer_now;
+    } else if ((uint32_t)delta >= WS_TIMER_RANGE) {
+        delta = WS_TIMER_RANGE - 1;
+        timer->expires = ws_timer_now + delta;
+    }
+
+    int level = 0;
+    while (level < WS_TIMER_LEVELS - 1 && (uint32_t)delta >= (1u << (WS_TIMER_SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    uint32_t slot = (timer->expires >> (WS_TIMER_SLOT_BITS * level)) & WS_TIMER_MASK;
+
+    ws_timer_t** head = &ws_wheel[level][slot];
+    timer->next = *head;
+    if (*head) (*head)->pprev = &timer->next;
+    *head = timer;
+    timer->pprev = head;
+    ws_wheel_used[level] |= 1ull << slot;
+    ws_timer_count++;
+}
+
+static void ws_timer_unlink(ws_timer_t* timer){
+    *timer->pprev = timer->next;
+    if (timer->next) timer->next->pprev = timer->pprev;
+    timer->next = NULL;
+    timer->pprev = NULL;
+    ws_timer_count--;
+}
+
+void ws_timer_init(ws_timer_t* timer, ws_timer_fn fn, void* arg){
+    *timer = (ws_timer_t){.fn = fn, .arg = arg};
+}
+
+static uint32_t ws_timer_ms_to_ticks(uint32_t ms){
+    return (ms + WS_TIMER_TICK_MS - 1) / WS_TIMER_TICK_MS;
+}
+
+static void ws_timer_prepare(ws_timer_t* timer){
+    if (!ws_timer_clock_set) {
+        ws_timer_now = ws_timer_clock();
+        ws_timer_clock_set = true;
+    }
+    if (timer->pprev) ws_timer_unlink(timer);
+}
+
+void ws_timer_start(ws_timer_t* timer, uint32_t delay_ms, uint32_t period_ms){
+    ws_timer_prepare(timer);
+
+    // The current tick has already begun: count from the next boundary so a
+    // timer never fires before its delay has elapsed
+    timer->expires = ws_timer_clock() + ws_timer_ms_to_ticks(delay_ms) + 1;
+    timer->period = ws_timer_ms_to_ticks(period_ms);
+    if (period_ms && timer->period == 0) timer->period = 1;
+    ws_timer_link(timer);
+}
+
+void ws_timer_start_aligned(ws_timer_t* timer, uint32_t period_ms){
+    ws_timer_prepare(timer);
+
+    timer->period = ws_timer_ms_to_ticks(period_ms);
+    if (timer->period == 0) timer->period = 1;
+    uint32_t next = ws_timer_clock() + 1;
+    timer->expires = next + (timer->period - next % timer->period) % timer->period;
+    ws_timer_link(timer);
+}
+
+void ws_timer_cancel(ws_timer_t* timer){
+    if (timer->pprev) ws_timer_unlink(timer);
+}
+
+bool ws_timer_pending(const ws_timer_t* timer){
+    return timer->pprev != NULL;
+}
+
+// Moves the timers of one upper-level slot down to where they now belong
+static void ws_timer_cascade(int level, uint32_t slot){
+    ws_timer_t* list = ws_wheel[level][slot];
+    ws_wheel[level][slot] = NULL;
+    ws_wheel_used[level] &= ~(1ull << slot);
+
+    while (list) {
+        ws_timer_t* timer = list;
+        list = timer->next;
+        ws_timer_count--;
+        ws_timer_link(timer);
+    }
+}
+
+static void ws_timer_tick(void){
+    uint32_t tick = ws_timer_now;
+    uint32_t slot = tick & WS_TIMER_MASK;
+
+    if (slot == 0) {
+        for (int level = 1; level < WS_TIMER_LEVELS; level++) {
+            uint32_t upper = (tick >> (WS_TIMER_SLOT_BITS * level)) & WS_TIMER_MASK;
+            ws_timer_cascade(level, upper);
+            if (upper != 0) break;
+        }
+    }
+
+    // Advance first so timers re-armed below for "now" land on the next tick
+    ws_timer_now = tick + 1;
+
+    ws_timer_t* pending = ws_wheel[0][slot];
+    ws_wheel[0][slot] = NULL;
+    ws_wheel_used[0] &= ~(1ull << slot);
+    if (pending) pending->pprev = &pending;
+
+    ws_timer_t* timer;
+    while ((timer = pending)) {
+        ws_timer_unlink(timer);
+        if (timer->period) {
+            timer->expires += timer->period;
+            ws_timer_link(timer);
+        }
+        timer->fn(timer, timer->arg);
+    }
+}
+
+void ws_timer_run(void){
+    if (!ws_timer_clock_set) return;
+
+    uint32_t target = ws_timer_clock();
+    if (ws_timer_count == 0) {
+        ws_timer_now = target + 1;
+        return;
+    }
+    while ((int32_t)(target - ws_timer_now) >= 0) {
+        ws_timer_tick();
+    }
+}
+
+absolute_time_t ws_timer_next_deadline(void){
+    if (ws_timer_count == 0) return at_the_end_of_time;
+
+    uint32_t pos = ws_timer_now & WS_TIMER_MASK;
+    uint32_t ahead = WS_TIMER_SLOTS;
+
+    while (ws_wheel_used[0]) {
+        uint64_t used = ws_wheel_used[0];
+        uint64_t rotated = pos ? (used >> pos) | (used << (WS_TIMER_SLOTS - pos)) : used;
+        uint32_t d = __builtin_ctzll(rotated);
+        uint32_t slot = (pos + d) & WS_TIMER_MASK;
+        if (ws_wheel[0][slot]) {
+            ahead = d;
+            break;
+        }
+        ws_wheel_used[0] &= ~(1ull << slot);
+    }
+
+    // Upper-level timers come down at the next cascade (when level 0 wraps)
+    for (int level = 1; level < WS_TIMER_LEVELS; level++) {
+        if (ws_wheel_used[level]) {
+            uint32_t boundary = pos ? WS_TIMER_SLOTS - pos : 0;
+            if (boundary < ahead) ahead = boundary;
+            break;
+        }
+    }
+
+    uint64_t tick = (uint64_t)ws_timer_now + ahead;
+    return from_us_since_boot(tick * WS_TIMER_TICK_MS * 1000u);
+}
@@ -0,0 +1,82 @@
+#ifndef WS_TIMER_H
+#define WS_TIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/**
+ * @brief Wheel resolution. Timers fire on the first tick at or after their
+ *        expiry, so this is also their worst-case lateness.
+ */
+#ifndef WS_TIMER_TICK_MS
+#define WS_TIMER_TICK_MS 10
+#endif
+
+#define WS_TIMER_SLOT_BITS 6
+#define WS_TIMER_SLOTS     (1u << WS_TIMER_SLOT_BITS)
+#define WS_TIMER_LEVELS    4   /**< 64^4 ticks: about 46 hours at 10 ms. */
+
+struct ws_timer;
+
+/**
+ * @typedef ws_timer_fn
+ * @brief Timer callback. May start, restart or cancel any timer, including
+ *        its own.
+ */
+typedef void(*ws_timer_fn)(struct ws_timer* timer, void* arg);
+
+/**
+ * @struct ws_timer_t
+ * @brief Caller-owned timer, linked into the wheel while pending.
+ */
+typedef struct ws_timer {
+    struct ws_timer*  next;    /**< Next timer in the same slot. */
+    struct ws_timer** pprev;   /**< Link pointing at this timer, NULL when idle. */
+    uint32_t          expires; /**< Tick at which the timer fires. */
+    uint32_t          period;  /**< Reload in ticks, 0 for one-shot. */
+    ws_timer_fn       fn;      /**< Callback. */
+    void*             arg;     /**< Callback argument. */
+} ws_timer_t;
+
+/**
+ * @brief Prepare a timer. Must be called once before any other use.
+ */
+void ws_timer_init(ws_timer_t* timer, ws_timer_fn fn, void* arg);
+
+/**
+ * @brief Arm (or re-arm) a timer. O(1).
+ * @param timer     Timer to arm.
+ * @param delay_ms  Time until the first expiry.
+ * @param period_ms Interval of later expiries, 0 for a one-shot timer.
+ */
+void ws_timer_start(ws_timer_t* timer, uint32_t delay_ms, uint32_t period_ms);
+
+/**
+ * @brief Arm a periodic timer whose expiries fall on multiples of `period_ms`
+ *        since boot, so timers with equal or harmonic periods share ticks.
+ */
+void ws_timer_start_aligned(ws_timer_t* timer, uint32_t period_ms);
+
+/**
+ * @brief Disarm a timer. O(1), harmless on an idle timer.
+ */
+void ws_timer_cancel(ws_timer_t* timer);
+
+/**
+ * @brief Whether the timer is armed.
+ */
+bool ws_timer_pending(const ws_timer_t* timer);
+
+/**
+ * @brief Fire every timer due at or before now. Called by ws_loop_run_once().
+ */
+void ws_timer_run(void);
+
+/**
+ * @brief Time of the next tick that has work (a timer or a cascade),
+ *        at_the_end_of_time if no timer is armed.
+ */
+absolute_time_t ws_timer_next_deadline(void);
+
+#endif /* WS_TIMER_H */
@@ -0,0 +1,37 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// Gerado por htmltoh.py: não edite
+
+#include "http.h"
+#include "index.h"
+#include "status.h"
+#include "mouse.h"
+
+static const http_asset_t http_assets[] = {
+    { "/index", INDEX_MIME, INDEX_BODY, INDEX_BODY_LEN, INDEX_BODY_GZ, INDEX_BODY_GZ_LEN, INDEX_BODY_ETAG, INDEX_BODY_GZ_ETAG },
+    { "/", INDEX_MIME, INDEX_BODY, INDEX_BODY_LEN, INDEX_BODY_GZ, INDEX_BODY_GZ_LEN, INDEX_BODY_ETAG, INDEX_BODY_GZ_ETAG },
+    { "/status", STATUS_MIME, STATUS_BODY, STATUS_BODY_LEN, STATUS_BODY_GZ, STATUS_BODY_GZ_LEN, STATUS_BODY_ETAG, STATUS_BODY_GZ_ETAG },
+    { "/mouse", MOUSE_MIME, MOUSE_BODY, MOUSE_BODY_LEN, MOUSE_BODY_GZ, MOUSE_BODY_GZ_LEN, MOUSE_BODY_ETAG, MOUSE_BODY_GZ_ETAG },
+};
+#define HTTP_ASSETS_COUNT (sizeof(http_assets) / sizeof(http_assets[0]))
+
+static const uint16_t http_route_displace[] = {1, 0};
+
+static const http_route_slot_t http_route_slots[] = {
+    { "/mouse", 6, 3 },
+    { "/status", 7, 2 },
+    { "/index", 6, 0 },
+    { "/", 1, 1 },
+};
+
+static const http_route_table_t http_route_table = {
+    .assets = http_assets,
+    .count = HTTP_ASSETS_COUNT,
+    .displace = http_route_displace,
+    .slots = http_route_slots,
+    .buckets = 2,
+    .seed = 0u,
+};
+
+#endif /* ASSETS_H */
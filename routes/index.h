@@ -1,57 +1,250 @@
 #ifndef INDEX_H
 #define INDEX_H
 
-// Enhanced WebSocket Chat page with navigation links
-#define INDEX_BODY \
-    "<!DOCTYPE html>" \
-    "<html lang=\"pt-BR\">" \
-    "<head>" \
-    "  <meta charset=\"utf-8\">" \
-    "  <meta http-equiv=\"X-UA-Compatible\" content=\"IE=edge\">" \
-    "  <meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">" \
-    "  <title>WebSocket Chat</title>" \
-    "  <style>" \
-    "    body { font-family: 'Segoe UI', Tahoma, sans-serif; background: linear-gradient(135deg, #74ABE2 0%, #5563DE 100%); color: #fff; display: flex; flex-direction: column; align-items: center; justify-content: center; height: 100vh; margin: 0; }" \
-    "    #container { background: rgba(0,0,0,0.7); padding: 2rem; border-radius: 12px; box-shadow: 0 8px 16px rgba(0,0,0,0.8); width: 90%; max-width: 500px; }" \
-    "    h1 { text-align: center; margin-bottom: 1rem; }" \
-    "    nav { display: flex; justify-content: center; gap: 1rem; margin-bottom: 1.5rem; }" \
-    "    nav a { color: #FFD700; text-decoration: none; font-weight: bold; }" \
-    "    #log { height: 200px; overflow-y: auto; background: rgba(255,255,255,0.1); padding: 1rem; border-radius: 8px; margin-bottom: 1rem; }" \
-    "    .chat-input { display: flex; }" \
-    "    .chat-input input { flex: 1; padding: 0.75rem 1rem; border: none; border-radius: 4px 0 0 4px; outline: none; }" \
-    "    .chat-input button { padding: 0.75rem 1rem; border: none; background: #FF6B6B; color: #fff; cursor: pointer; border-radius: 0 4px 4px 0; }" \
-    "    .message { margin: 0.5rem 0; }" \
-    "  </style>" \
-    "</head>" \
-    "<body>" \
-    "  <div id=\"container\">" \
-    "    <h1>WebSocket Chat</h1>" \
-    "    <nav>" \
-    "      <a href=\"/index\">Chat</a>" \
-    "      <a href=\"/mouse\">Mouse</a>" \
-    "      <a href=\"/status\">Status</a>" \
-    "    </nav>" \
-    "    <div id=\"log\"></div>" \
-    "    <div class=\"chat-input\">" \
-    "      <input type=\"text\" id=\"Itext\" placeholder=\"Digite sua mensagem...\" />" \
-    "      <button id=\"sendBtn\">Enviar</button>" \
-    "    </div>" \
-    "  </div>" \
-    "  <script>" \
-    "    const logEl = document.getElementById('log');" \
-    "    const inputEl = document.getElementById('Itext');" \
-    "    const btnEl = document.getElementById('sendBtn');" \
-    "    const socket = new WebSocket('ws://' + location.host);" \
-    "    socket.addEventListener('open', () => appendMessage('[Sistema] Conectado'));" \
-    "    socket.addEventListener('message', e => appendMessage('[Servidor] ' + e.data));" \
-    "    socket.addEventListener('close', e => appendMessage('[Sistema] Desconectado (código ' + e.code + ')'));" \
-    "    socket.addEventListener('error', err => appendMessage('[Erro] ' + err));" \
-    "    btnEl.addEventListener('click', sendMsg);" \
-    "    inputEl.addEventListener('keypress', e => { if (e.key === 'Enter') sendMsg(); });" \
-    "    function sendMsg() { const msg = inputEl.value.trim(); if (msg) { socket.send(msg); appendMessage('[Você] ' + msg); inputEl.value = ''; } }" \
-    "    function appendMessage(text) { const div = document.createElement('div'); div.className = 'message'; div.textContent = text; logEl.appendChild(div); logEl.scrollTop = logEl.scrollHeight; }" \
-    "  </script>" \
-    "</body>" \
-    "</html>"
+// Gerado por htmltoh.py a partir de index.html: não edite
 
-#endif /* INDEX_H */
\ No newline at end of file
+#include <stdint.h>
+
+#define INDEX_MIME "text/html; charset=UTF-8"
+
+static const uint8_t INDEX_BODY[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c,
+    0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x70, 0x74, 0x2d, 0x42, 0x52,
+    0x22, 0x3e, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68,
+    0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x3e, 0x3c, 0x6d,
+    0x65, 0x74, 0x61, 0x20, 0x68, 0x74, 0x74, 0x70, 0x2d, 0x65, 0x71, 0x75, 0x69, 0x76, 0x3d, 0x22,
+    0x58, 0x2d, 0x55, 0x41, 0x2d, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x22,
+    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x49, 0x45, 0x3d, 0x65, 0x64, 0x67,
+    0x65, 0x22, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76,
+    0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77,
+    0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63,
+    0x61, 0x6c, 0x65, 0x3d, 0x31, 0x2e, 0x30, 0x22, 0x3e, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e,
+    0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x43, 0x68, 0x61, 0x74, 0x3c, 0x2f,
+    0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x62, 0x6f, 0x64,
+    0x79, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x27, 0x53,
+    0x65, 0x67, 0x6f, 0x65, 0x20, 0x55, 0x49, 0x27, 0x2c, 0x54, 0x61, 0x68, 0x6f, 0x6d, 0x61, 0x2c,
+    0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67,
+    0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61,
+    0x64, 0x69, 0x65, 0x6e, 0x74, 0x28, 0x31, 0x33, 0x35, 0x64, 0x65, 0x67, 0x2c, 0x23, 0x37, 0x34,
+    0x41, 0x42, 0x45, 0x32, 0x20, 0x30, 0x25, 0x2c, 0x23, 0x35, 0x35, 0x36, 0x33, 0x44, 0x45, 0x20,
+    0x31, 0x30, 0x30, 0x25, 0x29, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66,
+    0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x66, 0x6c,
+    0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x63, 0x6f, 0x6c,
+    0x75, 0x6d, 0x6e, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a,
+    0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x68, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x30, 0x30, 0x76, 0x68, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x3a, 0x30, 0x7d, 0x23, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x7b, 0x62,
+    0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30,
+    0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2e, 0x37, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+    0x67, 0x3a, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61,
+    0x64, 0x69, 0x75, 0x73, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68,
+    0x61, 0x64, 0x6f, 0x77, 0x3a, 0x30, 0x20, 0x38, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70, 0x78, 0x20,
+    0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2e, 0x38, 0x29, 0x3b,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x39, 0x30, 0x25, 0x3b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3a, 0x35, 0x30, 0x30, 0x70, 0x78, 0x7d, 0x68, 0x31, 0x7b, 0x74, 0x65, 0x78,
+    0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x6d,
+    0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x72, 0x65,
+    0x6d, 0x7d, 0x6e, 0x61, 0x76, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c,
+    0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+    0x6e, 0x74, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x67, 0x61, 0x70, 0x3a, 0x31, 0x72,
+    0x65, 0x6d, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+    0x3a, 0x31, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x7d, 0x6e, 0x61, 0x76, 0x20, 0x61, 0x7b, 0x63, 0x6f,
+    0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x46, 0x46, 0x44, 0x37, 0x30, 0x30, 0x3b, 0x74, 0x65, 0x78, 0x74,
+    0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x6e, 0x6f, 0x6e, 0x65,
+    0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x6f, 0x6c,
+    0x64, 0x7d, 0x23, 0x6c, 0x6f, 0x67, 0x7b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x30,
+    0x30, 0x70, 0x78, 0x3b, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x2d, 0x79, 0x3a, 0x61,
+    0x75, 0x74, 0x6f, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x72,
+    0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2c, 0x32, 0x35, 0x35, 0x2c, 0x32, 0x35, 0x35, 0x2c,
+    0x30, 0x2e, 0x31, 0x29, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x72, 0x65,
+    0x6d, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a,
+    0x38, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f,
+    0x6d, 0x3a, 0x31, 0x72, 0x65, 0x6d, 0x7d, 0x2e, 0x63, 0x68, 0x61, 0x74, 0x2d, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x7d,
+    0x2e, 0x63, 0x68, 0x61, 0x74, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75,
+    0x74, 0x7b, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x31, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+    0x3a, 0x30, 0x2e, 0x37, 0x35, 0x72, 0x65, 0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0x62, 0x6f,
+    0x72, 0x64, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+    0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x34, 0x70, 0x78, 0x20, 0x30, 0x20, 0x30, 0x20,
+    0x34, 0x70, 0x78, 0x3b, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x6e, 0x6f, 0x6e, 0x65,
+    0x7d, 0x2e, 0x63, 0x68, 0x61, 0x74, 0x2d, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x30, 0x2e, 0x37, 0x35,
+    0x72, 0x65, 0x6d, 0x20, 0x31, 0x72, 0x65, 0x6d, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a,
+    0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a,
+    0x23, 0x46, 0x46, 0x36, 0x42, 0x36, 0x42, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66,
+    0x66, 0x66, 0x3b, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+    0x72, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a,
+    0x30, 0x20, 0x34, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 0x30, 0x7d, 0x2e, 0x6d, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x2e, 0x35, 0x72,
+    0x65, 0x6d, 0x20, 0x30, 0x7d, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x3c, 0x2f, 0x68,
+    0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69,
+    0x64, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x20, 0x3c,
+    0x68, 0x31, 0x3e, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x43, 0x68, 0x61,
+    0x74, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x20, 0x3c, 0x6e, 0x61, 0x76, 0x3e, 0x20, 0x3c, 0x61, 0x20,
+    0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x22, 0x3e, 0x43, 0x68,
+    0x61, 0x74, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x2f, 0x6d, 0x6f, 0x75, 0x73, 0x65, 0x22, 0x3e, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x3c, 0x2f, 0x61,
+    0x3e, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0x22, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x3c,
+    0x2f, 0x6e, 0x61, 0x76, 0x3e, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c,
+    0x6f, 0x67, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x74, 0x2d, 0x69, 0x6e, 0x70, 0x75,
+    0x74, 0x22, 0x3e, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d,
+    0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x49, 0x74, 0x65, 0x78, 0x74,
+    0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x44,
+    0x69, 0x67, 0x69, 0x74, 0x65, 0x20, 0x73, 0x75, 0x61, 0x20, 0x6d, 0x65, 0x6e, 0x73, 0x61, 0x67,
+    0x65, 0x6d, 0x2e, 0x2e, 0x2e, 0x22, 0x20, 0x2f, 0x3e, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f,
+    0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x42, 0x74, 0x6e, 0x22, 0x3e, 0x45,
+    0x6e, 0x76, 0x69, 0x61, 0x72, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x3e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x67, 0x45, 0x6c, 0x20,
+    0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6c, 0x6f, 0x67, 0x27, 0x29,
+    0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x20,
+    0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x49, 0x74, 0x65, 0x78, 0x74,
+    0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x74, 0x6e, 0x45, 0x6c, 0x20,
+    0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x65, 0x6e, 0x64, 0x42,
+    0x74, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x63, 0x6b,
+    0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b,
+    0x65, 0x74, 0x28, 0x27, 0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x27, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x63,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x73, 0x6f, 0x63,
+    0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+    0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6f, 0x70, 0x65, 0x6e, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20,
+    0x3d, 0x3e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x28, 0x27, 0x5b, 0x53, 0x69, 0x73, 0x74, 0x65, 0x6d, 0x61, 0x5d, 0x20, 0x43, 0x6f, 0x6e, 0x65,
+    0x63, 0x74, 0x61, 0x64, 0x6f, 0x27, 0x29, 0x29, 0x3b, 0x0a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+    0x72, 0x28, 0x27, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x27, 0x2c, 0x20, 0x65, 0x20, 0x3d,
+    0x3e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28,
+    0x27, 0x5b, 0x53, 0x65, 0x72, 0x76, 0x69, 0x64, 0x6f, 0x72, 0x5d, 0x20, 0x27, 0x20, 0x2b, 0x20,
+    0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x29, 0x3b, 0x0a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+    0x72, 0x28, 0x27, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x27, 0x2c, 0x20, 0x65, 0x20, 0x3d, 0x3e, 0x20,
+    0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x27, 0x5b,
+    0x53, 0x69, 0x73, 0x74, 0x65, 0x6d, 0x61, 0x5d, 0x20, 0x44, 0x65, 0x73, 0x63, 0x6f, 0x6e, 0x65,
+    0x63, 0x74, 0x61, 0x64, 0x6f, 0x20, 0x28, 0x63, 0xc3, 0xb3, 0x64, 0x69, 0x67, 0x6f, 0x20, 0x27,
+    0x20, 0x2b, 0x20, 0x65, 0x2e, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x29, 0x27, 0x29,
+    0x29, 0x3b, 0x0a, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+    0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x65, 0x72, 0x72, 0x6f,
+    0x72, 0x27, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e,
+    0x64, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x27, 0x5b, 0x45, 0x72, 0x72, 0x6f, 0x5d,
+    0x20, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x72, 0x72, 0x29, 0x29, 0x3b, 0x0a, 0x62, 0x74, 0x6e, 0x45,
+    0x6c, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+    0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20, 0x73, 0x65, 0x6e, 0x64,
+    0x4d, 0x73, 0x67, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x45, 0x6c, 0x2e, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27,
+    0x6b, 0x65, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x27, 0x2c, 0x20, 0x65, 0x20, 0x3d, 0x3e, 0x20,
+    0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2e, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x3d, 0x3d, 0x20,
+    0x27, 0x45, 0x6e, 0x74, 0x65, 0x72, 0x27, 0x29, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x4d, 0x73, 0x67,
+    0x28, 0x29, 0x3b, 0x20, 0x7d, 0x29, 0x3b, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x73, 0x65, 0x6e, 0x64, 0x4d, 0x73, 0x67, 0x28, 0x29, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x6d, 0x73, 0x67, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x45, 0x6c,
+    0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x6d, 0x73, 0x67, 0x29, 0x20, 0x7b, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+    0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6d, 0x73, 0x67, 0x29, 0x3b, 0x20, 0x61, 0x70, 0x70, 0x65,
+    0x6e, 0x64, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x27, 0x5b, 0x56, 0x6f, 0x63, 0xc3,
+    0xaa, 0x5d, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x6d, 0x73, 0x67, 0x29, 0x3b, 0x20, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x45, 0x6c, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x27, 0x3b,
+    0x20, 0x7d, 0x20, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70,
+    0x70, 0x65, 0x6e, 0x64, 0x4d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x74, 0x65, 0x78, 0x74,
+    0x29, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x69, 0x76, 0x20, 0x3d, 0x20,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45,
+    0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x64, 0x69, 0x76, 0x27, 0x29, 0x3b, 0x20, 0x64,
+    0x69, 0x76, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x27,
+    0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x27, 0x3b, 0x20, 0x64, 0x69, 0x76, 0x2e, 0x74, 0x65,
+    0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74,
+    0x3b, 0x20, 0x6c, 0x6f, 0x67, 0x45, 0x6c, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68,
+    0x69, 0x6c, 0x64, 0x28, 0x64, 0x69, 0x76, 0x29, 0x3b, 0x20, 0x6c, 0x6f, 0x67, 0x45, 0x6c, 0x2e,
+    0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x67, 0x45,
+    0x6c, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3b, 0x20,
+    0x7d, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79,
+    0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+#define INDEX_BODY_LEN 2472
+#define INDEX_BODY_ETAG "\"ee20a128e1b6c1dc\""
+
+static const uint8_t INDEX_BODY_GZ[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x56, 0xeb, 0x6e, 0xdb, 0x36,
+    0x14, 0xfe, 0xbf, 0xa7, 0xe0, 0x14, 0x14, 0xb2, 0x31, 0x4b, 0x96, 0xd3, 0x26, 0xed, 0x24, 0xcb,
+    0x40, 0x93, 0xb8, 0x58, 0x80, 0x75, 0x1b, 0x96, 0x76, 0x17, 0x0c, 0xfd, 0x41, 0x8b, 0xc7, 0x12,
+    0x17, 0x89, 0x54, 0x49, 0xca, 0x17, 0x18, 0x7e, 0xa1, 0xfd, 0xdd, 0x23, 0xf4, 0xc5, 0x76, 0x48,
+    0xda, 0xb1, 0xdd, 0xa6, 0x19, 0x0c, 0xeb, 0x72, 0x2e, 0xdf, 0xf9, 0xce, 0x85, 0xc7, 0x1e, 0x7f,
+    0x7b, 0xf3, 0xf3, 0xf5, 0xbb, 0x3f, 0x7f, 0x99, 0x92, 0xca, 0x34, 0xf5, 0x64, 0x6c, 0xaf, 0xa4,
+    0xa6, 0xa2, 0xcc, 0x83, 0xd6, 0x44, 0x57, 0xbf, 0x06, 0x28, 0x02, 0xca, 0x26, 0xe3, 0x06, 0x0c,
+    0x25, 0x45, 0x45, 0x95, 0x06, 0x93, 0x07, 0x9d, 0x99, 0x47, 0xaf, 0x82, 0x9d, 0xb4, 0x32, 0xa6,
+    0x8d, 0xe0, 0x63, 0xc7, 0x17, 0x79, 0xf0, 0x47, 0xf4, 0xfe, 0x75, 0x74, 0x2d, 0x9b, 0x96, 0x1a,
+    0x3e, 0xab, 0x21, 0x20, 0x85, 0x14, 0x06, 0x04, 0xba, 0xdc, 0x4e, 0x73, 0x60, 0x25, 0xec, 0x9d,
+    0x04, 0x6d, 0x20, 0x0f, 0x16, 0x1c, 0x96, 0xad, 0x54, 0xe6, 0xc8, 0x6e, 0xc9, 0x99, 0xa9, 0x72,
+    0x06, 0x0b, 0x5e, 0x40, 0xe4, 0x5e, 0x06, 0x84, 0x0b, 0x6e, 0x38, 0xad, 0x23, 0x5d, 0xd0, 0x1a,
+    0xf2, 0x51, 0x9c, 0x20, 0x8a, 0xe1, 0xa6, 0x86, 0xc9, 0xef, 0x30, 0xbb, 0x93, 0xc5, 0x3d, 0x18,
+    0x72, 0x5d, 0x51, 0x33, 0x1e, 0x7a, 0xe9, 0x58, 0x9b, 0x35, 0xde, 0x66, 0x92, 0xad, 0x37, 0x73,
+    0x04, 0x8e, 0xe6, 0xb4, 0xe1, 0xf5, 0x3a, 0x0d, 0xef, 0xa0, 0x94, 0x40, 0xde, 0xdf, 0x86, 0x83,
+    0x77, 0xb4, 0x92, 0x0d, 0x1d, 0x68, 0x2a, 0x74, 0xa4, 0x41, 0xf1, 0x79, 0x36, 0xa3, 0xc5, 0x7d,
+    0xa9, 0x64, 0x27, 0x58, 0x5a, 0x73, 0x01, 0x54, 0x45, 0xa5, 0xa2, 0x8c, 0x23, 0xa9, 0xde, 0xe8,
+    0xf9, 0x05, 0x83, 0x72, 0x70, 0xf6, 0xf2, 0xc5, 0xeb, 0xab, 0xe9, 0x39, 0x49, 0x9e, 0x0d, 0xce,
+    0x2e, 0x2e, 0x2e, 0x9f, 0xdf, 0x4c, 0xc9, 0x28, 0x49, 0x9e, 0xf5, 0xb3, 0x42, 0xd6, 0x52, 0xa5,
+    0x67, 0xf3, 0xf9, 0x3c, 0x63, 0x5c, 0xb7, 0x35, 0x5d, 0xa7, 0xf3, 0x1a, 0x56, 0x99, 0xbd, 0x44,
+    0x8c, 0x2b, 0x28, 0x0c, 0x97, 0x22, 0x45, 0xb3, 0xae, 0x11, 0x19, 0xad, 0x79, 0x29, 0x22, 0x6e,
+    0xa0, 0xd1, 0x69, 0x81, 0xf0, 0xa0, 0xb2, 0xbf, 0x3b, 0x6d, 0xf8, 0x7c, 0x1d, 0xed, 0xaa, 0xb0,
+    0x17, 0x57, 0xc0, 0xcb, 0xca, 0xa4, 0x18, 0x64, 0x51, 0x65, 0x0d, 0x55, 0x25, 0x17, 0x69, 0xb2,
+    0x3d, 0xb3, 0x56, 0x14, 0x29, 0xaa, 0xcd, 0x11, 0x67, 0x55, 0xce, 0x68, 0x2f, 0x19, 0xb8, 0x4f,
+    0xfc, 0xb2, 0x9f, 0xb5, 0x94, 0x31, 0x2e, 0xca, 0xf4, 0x5c, 0x41, 0x93, 0xcd, 0xa4, 0x62, 0xa0,
+    0x22, 0x9b, 0x4f, 0xa7, 0xd3, 0xd1, 0x79, 0xbb, 0x42, 0xd1, 0x2a, 0xd2, 0x15, 0x65, 0x72, 0x99,
+    0x26, 0xe4, 0x55, 0xbb, 0x22, 0xa3, 0x4b, 0xbc, 0x9c, 0xa0, 0xbc, 0xea, 0x67, 0xae, 0x01, 0xe9,
+    0xf7, 0xc9, 0x33, 0x0c, 0xbf, 0xf2, 0xed, 0x48, 0x2f, 0x92, 0xa4, 0x5d, 0x6d, 0xab, 0xd1, 0xc6,
+    0xc0, 0xca, 0x44, 0x2e, 0x9b, 0x3d, 0x61, 0xcf, 0x31, 0x9a, 0x49, 0x63, 0x64, 0x93, 0x8e, 0x30,
+    0xf4, 0x56, 0xd0, 0xc5, 0xe6, 0xa4, 0x28, 0x5f, 0xc9, 0xb5, 0xa4, 0xad, 0x73, 0xf8, 0x1c, 0x23,
+    0xbe, 0xd8, 0xa1, 0x10, 0xba, 0xd9, 0xd5, 0xf9, 0xcd, 0x9b, 0x9b, 0x97, 0x49, 0x92, 0xb9, 0xf0,
+    0x0c, 0x0a, 0xa9, 0xa8, 0x2b, 0xaf, 0x90, 0x02, 0x32, 0xd7, 0xee, 0xa5, 0xaf, 0xdb, 0x4c, 0xd6,
+    0x6c, 0x7b, 0x56, 0xcb, 0x72, 0xb3, 0x2b, 0xe4, 0xb9, 0x65, 0x9e, 0xc9, 0x05, 0xa8, 0x79, 0x2d,
+    0x97, 0xd1, 0x3a, 0xa5, 0x9d, 0x91, 0xd9, 0xe7, 0x45, 0x3c, 0xbf, 0xb8, 0x18, 0xec, 0xbf, 0x49,
+    0x3c, 0x3a, 0x94, 0x72, 0xf4, 0x65, 0x29, 0xb1, 0x70, 0x8f, 0x25, 0x1d, 0xe3, 0x49, 0x31, 0x11,
+    0x17, 0x6d, 0x67, 0x4e, 0x92, 0x3f, 0x56, 0x10, 0xaf, 0xb6, 0xe2, 0x74, 0xf4, 0x10, 0x03, 0x7b,
+    0x67, 0x13, 0x26, 0x47, 0xb1, 0x7c, 0x62, 0xa7, 0x71, 0x5f, 0x60, 0xaf, 0x12, 0xfc, 0xbc, 0xb0,
+    0xf9, 0x74, 0xc6, 0x0e, 0xac, 0x33, 0x3b, 0x09, 0x30, 0xeb, 0x90, 0x91, 0xd8, 0xfc, 0x3f, 0xf4,
+    0xa1, 0x00, 0x58, 0xdb, 0xcb, 0xab, 0xcb, 0xab, 0xe3, 0x89, 0x2e, 0x3a, 0xa5, 0xf1, 0xb9, 0x95,
+    0xdc, 0xf5, 0xe9, 0x94, 0x87, 0x63, 0xe0, 0xbe, 0xc9, 0x36, 0x6e, 0x40, 0x6b, 0x5a, 0xc2, 0x66,
+    0x3f, 0xa9, 0xae, 0x75, 0xa8, 0x18, 0x0f, 0xfd, 0x79, 0x1c, 0x0f, 0xfd, 0x2e, 0xb1, 0xe7, 0x72,
+    0x32, 0x66, 0x7c, 0x41, 0x38, 0xcb, 0x83, 0x87, 0x69, 0x0e, 0x26, 0x64, 0x5c, 0x8d, 0xbe, 0x38,
+    0xd2, 0x28, 0x22, 0x63, 0xec, 0x3f, 0x5e, 0x71, 0xd7, 0x28, 0x98, 0xe7, 0xc1, 0x90, 0x0b, 0x06,
+    0xab, 0x60, 0xe2, 0x0d, 0xe8, 0xb1, 0xa6, 0x91, 0x9d, 0xc6, 0x25, 0xf3, 0xd6, 0xde, 0x3e, 0x53,
+    0x69, 0x43, 0x4d, 0xa7, 0x83, 0xc9, 0x9d, 0xbb, 0x7b, 0xe5, 0xd0, 0x03, 0xef, 0xb9, 0xe0, 0xac,
+    0xe0, 0x6a, 0x19, 0xe2, 0xeb, 0x4e, 0x58, 0xd4, 0x54, 0x6b, 0xe4, 0xf8, 0x50, 0x54, 0x4b, 0xd2,
+    0x57, 0xd7, 0xac, 0x5b, 0xdc, 0x60, 0x76, 0x08, 0x03, 0xe7, 0x7b, 0xeb, 0x1f, 0xb1, 0xd7, 0x05,
+    0x54, 0x38, 0x79, 0xa0, 0xf2, 0xe0, 0x86, 0x97, 0x78, 0xce, 0x89, 0xee, 0x28, 0x69, 0x40, 0xd8,
+    0xe2, 0x34, 0x71, 0x1c, 0x07, 0x64, 0x88, 0x28, 0xbe, 0x3b, 0xce, 0x55, 0x83, 0x60, 0x57, 0x46,
+    0x04, 0x93, 0xa9, 0x58, 0x70, 0xaa, 0xc6, 0x43, 0xaf, 0xb3, 0xfc, 0x3c, 0x15, 0x77, 0x1b, 0xeb,
+    0x42, 0xf1, 0xd6, 0x4c, 0xb0, 0x60, 0xda, 0x10, 0xa4, 0x3a, 0xad, 0x49, 0x4e, 0x98, 0x2c, 0x3a,
+    0xc4, 0x36, 0x71, 0x09, 0x66, 0x5a, 0x83, 0x7d, 0xbc, 0x5a, 0xdf, 0xb2, 0x5e, 0x88, 0x06, 0x61,
+    0x3f, 0xfb, 0xc6, 0x5b, 0x3b, 0xca, 0x4f, 0xdb, 0x3b, 0xfe, 0x07, 0x8f, 0x99, 0x11, 0x4f, 0xdb,
+    0xef, 0x48, 0x1f, 0x3c, 0xb4, 0xef, 0x5a, 0x4e, 0x04, 0x2c, 0xc9, 0x43, 0x17, 0x7b, 0xe1, 0x52,
+    0xa7, 0xc3, 0x61, 0x48, 0xbe, 0x43, 0xca, 0x85, 0x3b, 0xa9, 0x71, 0x25, 0xb5, 0x41, 0x37, 0xef,
+    0x10, 0xe3, 0x78, 0x4e, 0x17, 0x08, 0xfb, 0x23, 0xd7, 0xb8, 0x10, 0x40, 0xf5, 0x42, 0xd9, 0x82,
+    0x08, 0x07, 0xa4, 0xd7, 0x27, 0xf9, 0x84, 0xd0, 0x16, 0xdf, 0xd8, 0x5b, 0x3f, 0x5b, 0xbd, 0xf0,
+    0xaf, 0x3b, 0x6b, 0xd6, 0xd0, 0x0f, 0xe4, 0x1a, 0x67, 0xb7, 0x30, 0xb8, 0xc1, 0xc2, 0xfe, 0x53,
+    0x60, 0xbb, 0xa9, 0x44, 0x3c, 0x78, 0x14, 0x0e, 0xd4, 0x82, 0x33, 0xa9, 0x3e, 0x10, 0x4b, 0x11,
+    0x62, 0x46, 0x0d, 0x7d, 0x12, 0xaf, 0xa8, 0xa5, 0xfe, 0x3a, 0xda, 0x9e, 0xdc, 0x0d, 0xe8, 0x62,
+    0xcf, 0x8f, 0xf4, 0x8a, 0x4f, 0xff, 0x32, 0x5e, 0xca, 0x5d, 0x88, 0x42, 0x32, 0xc0, 0x87, 0xb0,
+    0xff, 0x34, 0x71, 0x50, 0x4a, 0x2a, 0x1b, 0x48, 0xa9, 0xc7, 0x42, 0x4d, 0x51, 0xbd, 0x23, 0xad,
+    0x94, 0x05, 0x72, 0x1d, 0x7b, 0x94, 0x30, 0x2f, 0xee, 0x11, 0xc7, 0x36, 0xec, 0xad, 0x2e, 0xd1,
+    0x72, 0x37, 0x0d, 0x8f, 0xd8, 0xde, 0xc3, 0xba, 0x55, 0x18, 0x62, 0x9f, 0xdf, 0x86, 0xf0, 0x39,
+    0xe9, 0x41, 0x8c, 0x72, 0x92, 0xe7, 0x39, 0x09, 0xa7, 0x76, 0x09, 0x84, 0xfd, 0x3d, 0x58, 0xaf,
+    0x9f, 0x91, 0x2d, 0x22, 0xce, 0x3b, 0xe1, 0x7e, 0xe3, 0x0e, 0x72, 0x74, 0xf5, 0x63, 0xd1, 0xe8,
+    0x12, 0x67, 0x62, 0x1f, 0x72, 0x41, 0xeb, 0x0e, 0x62, 0xa3, 0x78, 0x63, 0x5d, 0x2d, 0x38, 0xea,
+    0xad, 0xf1, 0xae, 0x0c, 0xd6, 0xdf, 0x89, 0xb2, 0x2f, 0x12, 0xfe, 0x4d, 0x16, 0x9f, 0xfe, 0xf1,
+    0x19, 0x7b, 0x83, 0x13, 0x4c, 0x8c, 0x11, 0x86, 0x48, 0x86, 0x6c, 0x0f, 0x64, 0x4e, 0x11, 0xec,
+    0x7c, 0x1f, 0x68, 0xd9, 0xd3, 0x7d, 0x34, 0xdd, 0x85, 0x02, 0x6a, 0x60, 0x37, 0xe0, 0xbd, 0x10,
+    0xb5, 0x38, 0xd8, 0xd6, 0x28, 0x76, 0x2b, 0xe0, 0x27, 0xfc, 0xbb, 0x62, 0x23, 0xec, 0x87, 0xc9,
+    0xab, 0x2c, 0xe2, 0xb5, 0xff, 0x19, 0x43, 0xa5, 0x7d, 0xcb, 0xfc, 0xb9, 0x8c, 0x7d, 0xe4, 0xeb,
+    0x8a, 0xd7, 0xac, 0x87, 0x96, 0xfd, 0xbd, 0x1c, 0x8f, 0xb0, 0xac, 0xeb, 0x77, 0xb2, 0x45, 0xfb,
+    0x63, 0xc9, 0x0f, 0xee, 0x07, 0x0a, 0xe9, 0xe3, 0xae, 0xf4, 0xa7, 0x1c, 0x97, 0x80, 0x5b, 0x93,
+    0x43, 0xf7, 0xc7, 0xec, 0x3f, 0xbc, 0xdc, 0x19, 0x5b, 0xa8, 0x09, 0x00, 0x00,
+};
+#define INDEX_BODY_GZ_LEN 1197
+#define INDEX_BODY_GZ_ETAG "\"65376e6585173f53\""
+
+#endif /* INDEX_H */
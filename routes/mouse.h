@@ -1,46 +1,168 @@
 #ifndef MOUSE_H
 #define MOUSE_H
 
-#define MOUSE_BODY \
-    "<!DOCTYPE html>" \
-    "<html lang=\"pt-BR\">" \
-    "<head>" \
-    "  <meta charset=\"utf-8\">" \
-    "  <meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">" \
-    "  <title>Mouse Tracker</title>" \
-    "  <style>" \
-    "    body { font-family: 'Segoe UI', Tahoma, sans-serif; background: #fafafa; color: #333; display: flex; flex-direction: column; align-items: center; padding: 20px; margin: 0; }" \
-    "    header { font-size: 1.5rem; margin-bottom: 1rem; }" \
-    "    #coords { font-size: 1.25rem; margin: 10px 0; }" \
-    "    #log { width: 100%; max-width: 600px; height: 200px; overflow-y: auto; background: #fff; border: 1px solid #ddd; border-radius: 8px; padding: 10px; box-shadow: 0 2px 4px rgba(0,0,0,0.05); }" \
-    "  </style>" \
-    "</head>" \
-    "<body>" \
-    "  <header>Mouse Tracker → MCU</header>" \
-    "  <div id=\"coords\">X: 0, Y: 0</div>" \
-    "  <div id=\"log\"></div>" \
-    "  <script>" \
-    "    const coordsEl = document.getElementById('coords');" \
-    "    const logEl = document.getElementById('log');" \
-    "    const ws = new WebSocket('ws://' + location.host + '/mouse');" \
-    "    ws.addEventListener('open', () => appendLog('[Sistema] WS conectado'));" \
-    "    ws.addEventListener('message', e => appendLog('[MCU] ' + e.data));" \
-    "    ws.addEventListener('close', () => appendLog('[Sistema] WS desconectado'));" \
-    "    ws.addEventListener('error', err => appendLog('[Erro] ' + err));" \
-    "    window.addEventListener('mousemove', e => {" \
-    "      const x = e.clientX, y = e.clientY;" \
-    "      coordsEl.textContent = `X: ${x}, Y: ${y}`;" \
-    "      const msg = `${x},${y}`;" \
-    "      if (ws.readyState === WebSocket.OPEN) ws.send(msg);" \
-    "    });" \
-    "    function appendLog(text) {" \
-    "      const div = document.createElement('div');" \
-    "      div.textContent = text;" \
-    "      logEl.appendChild(div);" \
-    "      logEl.scrollTop = logEl.scrollHeight;" \
-    "    }" \
-    "  </script>" \
-    "</body>" \
-    "</html>"
+// Gerado por htmltoh.py a partir de mouse.html: não edite
+
+#include <stdint.h>
+
+#define MOUSE_MIME "text/html; charset=UTF-8"
+
+static const uint8_t MOUSE_BODY[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c,
+    0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x70, 0x74, 0x2d, 0x42, 0x52,
+    0x22, 0x3e, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68,
+    0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x3e, 0x3c, 0x6d,
+    0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f,
+    0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c,
+    0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31,
+    0x2e, 0x30, 0x22, 0x3e, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x4d, 0x6f, 0x75, 0x73, 0x65,
+    0x20, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e,
+    0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0x66, 0x6f, 0x6e, 0x74,
+    0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x27, 0x53, 0x65, 0x67, 0x6f, 0x65, 0x20, 0x55,
+    0x49, 0x27, 0x2c, 0x54, 0x61, 0x68, 0x6f, 0x6d, 0x61, 0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73,
+    0x65, 0x72, 0x69, 0x66, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a,
+    0x23, 0x66, 0x61, 0x66, 0x61, 0x66, 0x61, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x33,
+    0x33, 0x33, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b,
+    0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x63,
+    0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d,
+    0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+    0x3a, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x7d, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+    0x31, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f,
+    0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x72, 0x65, 0x6d, 0x7d, 0x23, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+    0x73, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x2e, 0x32, 0x35,
+    0x72, 0x65, 0x6d, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x20,
+    0x30, 0x7d, 0x23, 0x6c, 0x6f, 0x67, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30,
+    0x25, 0x3b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x36, 0x30, 0x30, 0x70,
+    0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x6f,
+    0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x2d, 0x79, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x62,
+    0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x62,
+    0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20,
+    0x23, 0x64, 0x64, 0x64, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69,
+    0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31,
+    0x30, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x30,
+    0x20, 0x32, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c,
+    0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2e, 0x30, 0x35, 0x29, 0x7d, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c,
+    0x65, 0x3e, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c,
+    0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3e, 0x4d, 0x6f, 0x75, 0x73, 0x65, 0x20, 0x54, 0x72, 0x61,
+    0x63, 0x6b, 0x65, 0x72, 0x20, 0xe2, 0x86, 0x92, 0x20, 0x4d, 0x43, 0x55, 0x3c, 0x2f, 0x68, 0x65,
+    0x61, 0x64, 0x65, 0x72, 0x3e, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63,
+    0x6f, 0x6f, 0x72, 0x64, 0x73, 0x22, 0x3e, 0x58, 0x3a, 0x20, 0x30, 0x2c, 0x20, 0x59, 0x3a, 0x20,
+    0x30, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d,
+    0x22, 0x6c, 0x6f, 0x67, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x3e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x73,
+    0x45, 0x6c, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+    0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x6f,
+    0x6f, 0x72, 0x64, 0x73, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f,
+    0x67, 0x45, 0x6c, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6c,
+    0x6f, 0x67, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x77, 0x73, 0x20, 0x3d,
+    0x20, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x27,
+    0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x27, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x2b, 0x20, 0x27, 0x2f, 0x6d, 0x6f, 0x75, 0x73, 0x65,
+    0x27, 0x29, 0x3b, 0x0a, 0x77, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6f, 0x70, 0x65, 0x6e, 0x27, 0x2c, 0x20,
+    0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4c, 0x6f, 0x67, 0x28,
+    0x27, 0x5b, 0x53, 0x69, 0x73, 0x74, 0x65, 0x6d, 0x61, 0x5d, 0x20, 0x57, 0x53, 0x20, 0x63, 0x6f,
+    0x6e, 0x65, 0x63, 0x74, 0x61, 0x64, 0x6f, 0x27, 0x29, 0x29, 0x3b, 0x0a, 0x77, 0x73, 0x2e, 0x61,
+    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x27, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x27, 0x2c, 0x20, 0x65, 0x20, 0x3d, 0x3e, 0x20,
+    0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4c, 0x6f, 0x67, 0x28, 0x27, 0x5b, 0x4d, 0x43, 0x55, 0x5d,
+    0x20, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x29, 0x3b, 0x0a, 0x77,
+    0x73, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+    0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20, 0x3d,
+    0x3e, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4c, 0x6f, 0x67, 0x28, 0x27, 0x5b, 0x53, 0x69,
+    0x73, 0x74, 0x65, 0x6d, 0x61, 0x5d, 0x20, 0x57, 0x53, 0x20, 0x64, 0x65, 0x73, 0x63, 0x6f, 0x6e,
+    0x65, 0x63, 0x74, 0x61, 0x64, 0x6f, 0x27, 0x29, 0x29, 0x3b, 0x0a, 0x77, 0x73, 0x2e, 0x61, 0x64,
+    0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27,
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x27, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x61,
+    0x70, 0x70, 0x65, 0x6e, 0x64, 0x4c, 0x6f, 0x67, 0x28, 0x27, 0x5b, 0x45, 0x72, 0x72, 0x6f, 0x5d,
+    0x20, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x72, 0x72, 0x29, 0x29, 0x3b, 0x0a, 0x77, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x27, 0x6d, 0x6f, 0x75, 0x73, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x27, 0x2c,
+    0x20, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x78, 0x20,
+    0x3d, 0x20, 0x65, 0x2e, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x58, 0x2c, 0x20, 0x79, 0x20, 0x3d,
+    0x20, 0x65, 0x2e, 0x63, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x59, 0x3b, 0x0a, 0x63, 0x6f, 0x6f, 0x72,
+    0x64, 0x73, 0x45, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x20, 0x3d, 0x20, 0x60, 0x58, 0x3a, 0x20, 0x24, 0x7b, 0x78, 0x7d, 0x2c, 0x20, 0x59, 0x3a, 0x20,
+    0x24, 0x7b, 0x79, 0x7d, 0x60, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6d, 0x73, 0x67,
+    0x20, 0x3d, 0x20, 0x60, 0x24, 0x7b, 0x78, 0x7d, 0x2c, 0x24, 0x7b, 0x79, 0x7d, 0x60, 0x3b, 0x0a,
+    0x69, 0x66, 0x20, 0x28, 0x77, 0x73, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74,
+    0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e,
+    0x4f, 0x50, 0x45, 0x4e, 0x29, 0x20, 0x77, 0x73, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6d, 0x73,
+    0x67, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x4c, 0x6f, 0x67, 0x28, 0x74, 0x65, 0x78, 0x74, 0x29,
+    0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x69, 0x76, 0x20, 0x3d, 0x20, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x64, 0x69, 0x76, 0x27, 0x29, 0x3b, 0x0a, 0x64, 0x69,
+    0x76, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+    0x74, 0x65, 0x78, 0x74, 0x3b, 0x0a, 0x6c, 0x6f, 0x67, 0x45, 0x6c, 0x2e, 0x61, 0x70, 0x70, 0x65,
+    0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x64, 0x69, 0x76, 0x29, 0x3b, 0x0a, 0x6c, 0x6f,
+    0x67, 0x45, 0x6c, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x54, 0x6f, 0x70, 0x20, 0x3d, 0x20,
+    0x6c, 0x6f, 0x67, 0x45, 0x6c, 0x2e, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x48, 0x65, 0x69, 0x67,
+    0x68, 0x74, 0x3b, 0x0a, 0x7d, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x3c, 0x2f,
+    0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+#define MOUSE_BODY_LEN 1516
+#define MOUSE_BODY_ETAG "\"36b9fdbe60116401\""
+
+static const uint8_t MOUSE_BODY_GZ[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x54, 0xeb, 0x6e, 0xdb, 0x36,
+    0x14, 0xfe, 0xdf, 0xa7, 0xe0, 0xec, 0x0e, 0x92, 0x51, 0xeb, 0xe2, 0x64, 0x2d, 0x02, 0x4a, 0xf2,
+    0x8f, 0x66, 0x06, 0x56, 0xa0, 0x37, 0xcc, 0x29, 0x92, 0x60, 0x28, 0x50, 0x5a, 0x3c, 0x92, 0x88,
+    0x51, 0xa2, 0x40, 0xd2, 0x17, 0xcd, 0xf0, 0xdf, 0x3e, 0x40, 0x1f, 0xb1, 0x4f, 0xb2, 0x43, 0xc9,
+    0x59, 0x9d, 0xa0, 0x69, 0x07, 0x41, 0x94, 0x78, 0xce, 0xc7, 0x8f, 0xe7, 0xf2, 0x91, 0xe9, 0x2f,
+    0xbf, 0xbf, 0xbb, 0xbc, 0xba, 0x7d, 0xbf, 0x20, 0x95, 0xad, 0xe5, 0x3c, 0x75, 0x23, 0x91, 0xac,
+    0x29, 0xb3, 0x51, 0x6b, 0x83, 0x97, 0x7f, 0x8e, 0xd0, 0x04, 0x8c, 0xcf, 0xd3, 0x1a, 0x2c, 0x23,
+    0x79, 0xc5, 0xb4, 0x01, 0x9b, 0x8d, 0xd6, 0xb6, 0x08, 0x2e, 0x46, 0x47, 0x6b, 0xc3, 0x6a, 0xc8,
+    0x46, 0x1b, 0x01, 0xdb, 0x56, 0x69, 0x3b, 0x22, 0xb9, 0x6a, 0x2c, 0x34, 0x88, 0xda, 0x0a, 0x6e,
+    0xab, 0x8c, 0xc3, 0x46, 0xe4, 0x10, 0xf4, 0x93, 0x29, 0x11, 0x8d, 0xb0, 0x82, 0xc9, 0xc0, 0xe4,
+    0x4c, 0x42, 0x36, 0x0b, 0x63, 0x64, 0xb1, 0xc2, 0x4a, 0x98, 0xbf, 0x51, 0x6b, 0x03, 0xe4, 0x4a,
+    0xb3, 0xfc, 0x6f, 0xd0, 0x69, 0x34, 0x18, 0x53, 0x63, 0x3b, 0xfc, 0xac, 0x14, 0xef, 0xf6, 0x05,
+    0xf2, 0x06, 0x05, 0xab, 0x85, 0xec, 0xa8, 0xb7, 0x84, 0x52, 0x01, 0xf9, 0xf0, 0xca, 0x9b, 0x5e,
+    0xb1, 0x4a, 0xd5, 0x6c, 0x6a, 0x58, 0x63, 0x02, 0x03, 0x5a, 0x14, 0xc9, 0x0a, 0x29, 0x4a, 0xad,
+    0xd6, 0x0d, 0xa7, 0xe3, 0x82, 0xb9, 0x27, 0xc9, 0x95, 0x54, 0x9a, 0x8e, 0xcf, 0xcf, 0xcf, 0x13,
+    0x2e, 0x4c, 0x2b, 0x59, 0x47, 0x0b, 0x09, 0xbb, 0xc4, 0x0d, 0x01, 0x17, 0x1a, 0x72, 0x2b, 0x54,
+    0x43, 0x11, 0xb6, 0xae, 0x9b, 0x84, 0x49, 0x51, 0x36, 0x81, 0xb0, 0x50, 0x1b, 0x9a, 0x63, 0x2a,
+    0xa0, 0x93, 0x96, 0x71, 0x2e, 0x9a, 0x92, 0x9e, 0xc5, 0xed, 0x2e, 0xa9, 0x99, 0x2e, 0x45, 0x43,
+    0xe3, 0x83, 0xab, 0x0d, 0xe8, 0x21, 0x32, 0x23, 0xfe, 0x01, 0x3a, 0x0b, 0x9f, 0x6b, 0xa8, 0x8f,
+    0x80, 0x60, 0xa5, 0xac, 0x55, 0x35, 0x9d, 0xa1, 0xe9, 0x30, 0xce, 0x95, 0xd2, 0xdc, 0xdc, 0xc3,
+    0x9e, 0x9d, 0x80, 0xe9, 0x0c, 0x99, 0x49, 0x7c, 0x18, 0x4b, 0x55, 0xee, 0xfb, 0x62, 0xa1, 0x25,
+    0xfe, 0x15, 0xbd, 0xbb, 0xa1, 0x76, 0xf4, 0x45, 0xec, 0xf6, 0xae, 0x40, 0x94, 0x95, 0xc5, 0x38,
+    0xdc, 0x44, 0x6d, 0x40, 0x17, 0x52, 0x6d, 0x83, 0x8e, 0xb2, 0xb5, 0x55, 0xf7, 0x33, 0x2f, 0xb0,
+    0x12, 0xb8, 0x25, 0x68, 0x3a, 0x43, 0x66, 0xa3, 0xa4, 0xe0, 0x64, 0xcc, 0x39, 0x3f, 0x5a, 0x03,
+    0xcd, 0xb8, 0x58, 0x1b, 0x7a, 0x81, 0x3c, 0x77, 0xd9, 0xb9, 0x18, 0xd0, 0xbd, 0x0b, 0x4c, 0xc5,
+    0xb8, 0xda, 0xd2, 0x98, 0x9c, 0xe1, 0xd2, 0xdf, 0xf0, 0xd5, 0xe5, 0x8a, 0xf9, 0xf1, 0xb4, 0x7f,
+    0xc2, 0xf8, 0xf9, 0xe4, 0x90, 0x46, 0x43, 0x6b, 0xd2, 0x68, 0x10, 0x88, 0x6b, 0xd1, 0x20, 0x16,
+    0xd0, 0xf7, 0x7b, 0x49, 0xbe, 0x7e, 0xfe, 0x42, 0xde, 0x5c, 0x7e, 0x18, 0x90, 0xe8, 0x25, 0x29,
+    0x17, 0x1b, 0x22, 0x78, 0x36, 0x1a, 0x6a, 0x32, 0x9a, 0xdf, 0x50, 0x12, 0x4f, 0xc9, 0x2d, 0x8e,
+    0x69, 0x84, 0xbe, 0x13, 0x04, 0x56, 0x03, 0x15, 0xd2, 0x1b, 0x53, 0x93, 0x6b, 0xd1, 0xda, 0x39,
+    0xea, 0xcb, 0x58, 0x32, 0x2c, 0x5d, 0x48, 0x92, 0x11, 0xae, 0xf2, 0x75, 0x8d, 0x6d, 0x0a, 0x4b,
+    0xb0, 0x0b, 0x09, 0xee, 0xf7, 0x65, 0xf7, 0x8a, 0xfb, 0xde, 0x80, 0xf1, 0x26, 0xc9, 0x93, 0x61,
+    0x0d, 0x92, 0xfd, 0x78, 0x01, 0x02, 0xbe, 0xa1, 0xb7, 0x06, 0xa1, 0x0d, 0x6c, 0xc9, 0x35, 0xac,
+    0x96, 0x0a, 0x33, 0xb1, 0xbe, 0xb7, 0x35, 0x34, 0x8a, 0x3c, 0xf2, 0x0c, 0xa9, 0x72, 0xe6, 0x24,
+    0x13, 0x56, 0x0a, 0xa1, 0xcf, 0x88, 0x17, 0xd5, 0x2e, 0x67, 0xb7, 0x7a, 0x6b, 0x42, 0x2c, 0xe7,
+    0x62, 0x83, 0xac, 0xaf, 0x85, 0xc1, 0xa3, 0x00, 0xda, 0xf7, 0x54, 0x0b, 0x8d, 0x37, 0x25, 0xfe,
+    0x84, 0x64, 0x73, 0xc2, 0x5a, 0x9c, 0xf1, 0xd7, 0xaa, 0xf4, 0xbd, 0xbf, 0x96, 0x0e, 0x52, 0xb3,
+    0x8f, 0xe4, 0x7a, 0xe9, 0x4e, 0x0e, 0x0a, 0x11, 0x2b, 0xef, 0x4d, 0x1e, 0xe3, 0xa9, 0xc1, 0x18,
+    0x56, 0x02, 0x52, 0xc1, 0x43, 0x26, 0x2c, 0xf1, 0x47, 0xe2, 0x62, 0x83, 0x90, 0x33, 0xcb, 0x1e,
+    0xa5, 0xc8, 0xa5, 0x32, 0xf0, 0xd3, 0x58, 0x38, 0x98, 0xff, 0x11, 0x0e, 0x68, 0xad, 0xb4, 0x0b,
+    0x46, 0xeb, 0x87, 0x64, 0x0b, 0x74, 0x1d, 0xe3, 0xd1, 0xba, 0x27, 0x10, 0x0d, 0x6a, 0xea, 0x7b,
+    0x39, 0xb9, 0xca, 0xd5, 0xa8, 0xe5, 0xbb, 0xac, 0xf6, 0xc7, 0x0e, 0xec, 0xb0, 0x01, 0x10, 0xe6,
+    0x52, 0x20, 0xfc, 0x66, 0x4a, 0xba, 0x93, 0xe9, 0xad, 0xeb, 0xd2, 0xa0, 0x80, 0xd0, 0xc2, 0xce,
+    0x5e, 0x0e, 0x97, 0x0e, 0x22, 0x3e, 0xa1, 0x98, 0x9e, 0xee, 0x77, 0x87, 0x5e, 0x4f, 0x4f, 0xf7,
+    0xdd, 0xe1, 0xd3, 0x5d, 0x43, 0x6b, 0x53, 0x3a, 0x7f, 0xef, 0x3c, 0x3a, 0x44, 0x41, 0x7c, 0x4c,
+    0x4c, 0xa3, 0x30, 0xbb, 0xa5, 0x65, 0x16, 0xb7, 0xcf, 0xb2, 0x6f, 0x0d, 0x0f, 0xdf, 0xbd, 0x5f,
+    0xbc, 0x9d, 0xa0, 0x12, 0x42, 0x83, 0x79, 0xf9, 0x48, 0x80, 0x79, 0x1c, 0xf0, 0x2d, 0xd6, 0x4d,
+    0x7f, 0x63, 0x9c, 0x64, 0xec, 0xa2, 0x98, 0xfc, 0x17, 0xba, 0xd3, 0xef, 0x89, 0xd0, 0x72, 0xdc,
+    0xc1, 0xc2, 0x51, 0x6b, 0xbe, 0x87, 0x5e, 0xa7, 0x14, 0xfc, 0x3c, 0x08, 0xde, 0xcd, 0x92, 0x27,
+    0xbd, 0x4e, 0xc3, 0x81, 0xfa, 0xb2, 0x12, 0x92, 0xfb, 0x88, 0x9c, 0xdc, 0xd9, 0xf1, 0x18, 0x28,
+    0x29, 0xaf, 0x54, 0x8b, 0xf8, 0x53, 0xcb, 0x1f, 0xfd, 0xcd, 0x80, 0xf1, 0xe1, 0xd1, 0x1c, 0x4e,
+    0x4a, 0x1a, 0x0d, 0xa7, 0x32, 0xea, 0x2f, 0xf7, 0x7f, 0x01, 0x7e, 0x9d, 0x06, 0x71, 0xec, 0x05,
+    0x00, 0x00,
+};
+#define MOUSE_BODY_GZ_LEN 834
+#define MOUSE_BODY_GZ_ETAG "\"4ad5958480942ad1\""
 
 #endif /* MOUSE_H */
@@ -1,36 +1,271 @@
 #ifndef STATUS_H
 #define STATUS_H
 
-// Página Status modernizada: exibe uptime em tempo real via WebSocket
-#define STATUS_BODY \
-    "<!DOCTYPE html>" \
-    "<html lang=\"pt-BR\">" \
-    "<head>" \
-    "  <meta charset=\"utf-8\">" \
-    "  <meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">" \
-    "  <title>Status de Execução</title>" \
-    "  <style>" \
-    "    body { font-family: 'Segoe UI', Tahoma, sans-serif; background: #eef2f5; color: #333; display: flex; flex-direction: column; align-items: center; padding: 20px; margin: 0; }" \
-    "    header { font-size: 1.5rem; margin-bottom: 1rem; color: #4a90e2; }" \
-    "    #uptime { font-size: 2rem; margin: 20px 0; background: #fff; padding: 10px 20px; border-radius: 8px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); }" \
-    "    #log { display: none; }" \
-    "  </style>" \
-    "</head>" \
-    "<body>" \
-    "  <header>⏱ Tempo de Atividade</header>" \
-    "  <div id=\"uptime\">--:--:--</div>" \
-    "  <script>" \
-    "    const uptimeEl = document.getElementById('uptime');" \
-    "    const ws = new WebSocket('ws://' + location.host + '/status');" \
-    "    ws.addEventListener('open', () => console.log('[Sistema] Conectado ao WS de status'));" \
-    "    ws.addEventListener('message', e => {" \
-    "      const data = e.data.startsWith('status:') ? e.data.slice(7) : e.data;" \
-    "      uptimeEl.textContent = data;" \
-    "    });" \
-    "    ws.addEventListener('close', () => console.log('[Sistema] Conexão WS encerrada'));" \
-    "    ws.addEventListener('error', err => console.error('[Erro WS]', err));" \
-    "  </script>" \
-    "</body>" \
-    "</html>"
+// Gerado por htmltoh.py a partir de status.html: não edite
+
+#include <stdint.h>
+
+#define STATUS_MIME "text/html; charset=UTF-8"
+
+static const uint8_t STATUS_BODY[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c,
+    0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x70, 0x74, 0x2d, 0x42, 0x52,
+    0x22, 0x3e, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68,
+    0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x3e, 0x3c, 0x6d,
+    0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f,
+    0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c,
+    0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31,
+    0x2e, 0x30, 0x22, 0x3e, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x20, 0x64, 0x65, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0xc3, 0xa7, 0xc3, 0xa3, 0x6f, 0x3c,
+    0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x62, 0x6f,
+    0x64, 0x79, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x27,
+    0x53, 0x65, 0x67, 0x6f, 0x65, 0x20, 0x55, 0x49, 0x27, 0x2c, 0x54, 0x61, 0x68, 0x6f, 0x6d, 0x61,
+    0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x62, 0x61, 0x63, 0x6b,
+    0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x65, 0x65, 0x66, 0x32, 0x66, 0x35, 0x3b, 0x63,
+    0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x33, 0x33, 0x33, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+    0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x2d, 0x64, 0x69, 0x72, 0x65,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x61, 0x6c, 0x69,
+    0x67, 0x6e, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72,
+    0x67, 0x69, 0x6e, 0x3a, 0x30, 0x7d, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x7b, 0x66, 0x6f, 0x6e,
+    0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x6d, 0x61,
+    0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x72, 0x65, 0x6d,
+    0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x34, 0x61, 0x39, 0x30, 0x65, 0x32, 0x7d, 0x23,
+    0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
+    0x3a, 0x32, 0x72, 0x65, 0x6d, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x32, 0x30, 0x70,
+    0x78, 0x20, 0x30, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23,
+    0x66, 0x66, 0x66, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78,
+    0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64,
+    0x69, 0x75, 0x73, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64,
+    0x6f, 0x77, 0x3a, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62,
+    0x61, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2e, 0x31, 0x29, 0x7d, 0x23, 0x6c, 0x6f,
+    0x67, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x3c,
+    0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62,
+    0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3e, 0xe2, 0x8f, 0xb1, 0x20,
+    0x54, 0x65, 0x6d, 0x70, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x41, 0x74, 0x69, 0x76, 0x69, 0x64, 0x61,
+    0x64, 0x65, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3e, 0x20, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x22, 0x3e, 0x2d, 0x2d, 0x3a,
+    0x2d, 0x2d, 0x3a, 0x2d, 0x2d, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x3e, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x63, 0x6f,
+    0x64, 0x65, 0x43, 0x62, 0x6f, 0x72, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x20, 0x7b,
+    0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x3d, 0x20, 0x6e, 0x65,
+    0x77, 0x20, 0x44, 0x61, 0x74, 0x61, 0x56, 0x69, 0x65, 0x77, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+    0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67, 0x20, 0x3d, 0x20, 0x61, 0x69, 0x20,
+    0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x61, 0x69, 0x20, 0x3c, 0x20, 0x32, 0x34,
+    0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x61, 0x69, 0x3b, 0x0a, 0x6c, 0x65, 0x74,
+    0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20,
+    0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20,
+    0x31, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x61, 0x69, 0x20, 0x2d, 0x20, 0x32, 0x34, 0x29, 0x3b, 0x20,
+    0x69, 0x2b, 0x2b, 0x29, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x35, 0x36, 0x20, 0x2b, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2e,
+    0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x28, 0x70, 0x6f, 0x73, 0x2b, 0x2b, 0x29, 0x3b,
+    0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x7d,
+    0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x28,
+    0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x62, 0x20,
+    0x3d, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x28,
+    0x70, 0x6f, 0x73, 0x2b, 0x2b, 0x29, 0x2c, 0x20, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x20, 0x3d, 0x20,
+    0x69, 0x62, 0x20, 0x3e, 0x3e, 0x20, 0x35, 0x2c, 0x20, 0x61, 0x69, 0x20, 0x3d, 0x20, 0x69, 0x62,
+    0x20, 0x26, 0x20, 0x33, 0x31, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x61, 0x6a, 0x6f, 0x72,
+    0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x37, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x61, 0x69,
+    0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x61, 0x69, 0x20, 0x3d, 0x3d,
+    0x3d, 0x20, 0x32, 0x31, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x61, 0x69, 0x20,
+    0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x31, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x61, 0x69, 0x20, 0x3d,
+    0x3d, 0x3d, 0x20, 0x32, 0x32, 0x20, 0x7c, 0x7c, 0x20, 0x61, 0x69, 0x20, 0x3d, 0x3d, 0x3d, 0x20,
+    0x32, 0x33, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
+    0x0a, 0x69, 0x66, 0x20, 0x28, 0x61, 0x69, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x35, 0x29, 0x20,
+    0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x68, 0x20, 0x3d, 0x20, 0x76, 0x69, 0x65, 0x77,
+    0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x70, 0x6f, 0x73, 0x29, 0x2c,
+    0x20, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x68, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x30, 0x29, 0x20, 0x26,
+    0x20, 0x33, 0x31, 0x2c, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x68, 0x20, 0x26, 0x20, 0x31, 0x30, 0x32,
+    0x33, 0x3b, 0x0a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x3b, 0x0a, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x76, 0x20, 0x3d, 0x20, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x3f,
+    0x20, 0x66, 0x20, 0x2a, 0x20, 0x32, 0x20, 0x2a, 0x2a, 0x20, 0x2d, 0x32, 0x34, 0x20, 0x3a, 0x20,
+    0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x33, 0x31, 0x20, 0x3f, 0x20, 0x28, 0x66, 0x20, 0x3f, 0x20,
+    0x4e, 0x61, 0x4e, 0x20, 0x3a, 0x20, 0x49, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x29, 0x20,
+    0x3a, 0x20, 0x28, 0x31, 0x30, 0x32, 0x34, 0x20, 0x2b, 0x20, 0x66, 0x29, 0x20, 0x2a, 0x20, 0x32,
+    0x20, 0x2a, 0x2a, 0x20, 0x28, 0x65, 0x20, 0x2d, 0x20, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x68, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30, 0x30, 0x30, 0x20,
+    0x3f, 0x20, 0x2d, 0x76, 0x20, 0x3a, 0x20, 0x76, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28,
+    0x61, 0x69, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x36, 0x29, 0x20, 0x7b, 0x20, 0x70, 0x6f, 0x73,
+    0x20, 0x2b, 0x3d, 0x20, 0x34, 0x3b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x69,
+    0x65, 0x77, 0x2e, 0x67, 0x65, 0x74, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x28, 0x70, 0x6f,
+    0x73, 0x20, 0x2d, 0x20, 0x34, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x61, 0x69,
+    0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x32, 0x37, 0x29, 0x20, 0x7b, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x2b,
+    0x3d, 0x20, 0x38, 0x3b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x69, 0x65, 0x77,
+    0x2e, 0x67, 0x65, 0x74, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x36, 0x34, 0x28, 0x70, 0x6f, 0x73, 0x20,
+    0x2d, 0x20, 0x38, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65,
+    0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x27, 0x43, 0x42, 0x4f, 0x52, 0x3a, 0x20, 0x73,
+    0x69, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x61, 0x69, 0x29, 0x3b, 0x0a, 0x7d,
+    0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x72, 0x67, 0x28, 0x61,
+    0x69, 0x29, 0x3b, 0x0a, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x6d, 0x61, 0x6a, 0x6f,
+    0x72, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20, 0x30, 0x3a, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x20, 0x6e, 0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20, 0x31, 0x3a, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31, 0x20, 0x2d, 0x20, 0x6e, 0x3b, 0x0a, 0x63, 0x61,
+    0x73, 0x65, 0x20, 0x32, 0x3a, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x6e, 0x3b, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38,
+    0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2c, 0x20, 0x70, 0x6f,
+    0x73, 0x20, 0x2d, 0x20, 0x6e, 0x2c, 0x20, 0x6e, 0x29, 0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20,
+    0x33, 0x3a, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x6e, 0x3b, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6e, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x54, 0x65, 0x78, 0x74, 0x44, 0x65, 0x63, 0x6f,
+    0x64, 0x65, 0x72, 0x28, 0x29, 0x2e, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x6e, 0x65, 0x77,
+    0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x2d, 0x20, 0x6e, 0x2c, 0x20, 0x6e, 0x29, 0x29,
+    0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20, 0x34, 0x3a, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+    0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x66, 0x72, 0x6f, 0x6d, 0x28, 0x7b, 0x6c, 0x65, 0x6e,
+    0x67, 0x74, 0x68, 0x3a, 0x20, 0x6e, 0x7d, 0x2c, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x29, 0x3b, 0x0a,
+    0x63, 0x61, 0x73, 0x65, 0x20, 0x35, 0x3a, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+    0x6d, 0x61, 0x70, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c,
+    0x65, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6e, 0x3b,
+    0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6b, 0x65,
+    0x79, 0x20, 0x3d, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x28, 0x29, 0x3b, 0x20, 0x6d, 0x61, 0x70, 0x5b,
+    0x6b, 0x65, 0x79, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x28, 0x29, 0x3b, 0x20, 0x7d,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x61, 0x70, 0x3b, 0x20, 0x7d, 0x0a, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x69,
+    0x74, 0x65, 0x6d, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x3d, 0x20, 0x6e, 0x20, 0x3d, 0x3e, 0x20, 0x53, 0x74,
+    0x72, 0x69, 0x6e, 0x67, 0x28, 0x6e, 0x29, 0x2e, 0x70, 0x61, 0x64, 0x53, 0x74, 0x61, 0x72, 0x74,
+    0x28, 0x32, 0x2c, 0x20, 0x27, 0x30, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+    0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x45, 0x6c, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x63, 0x6f,
+    0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x0a,
+    0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x77, 0x73, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x57,
+    0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x27, 0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x27,
+    0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74,
+    0x20, 0x2b, 0x20, 0x27, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3b, 0x0a, 0x77,
+    0x73, 0x2e, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x27,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x27, 0x3b, 0x0a, 0x77, 0x73,
+    0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+    0x72, 0x28, 0x27, 0x6f, 0x70, 0x65, 0x6e, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20,
+    0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x27, 0x5b, 0x53, 0x69,
+    0x73, 0x74, 0x65, 0x6d, 0x61, 0x5d, 0x20, 0x43, 0x6f, 0x6e, 0x65, 0x63, 0x74, 0x61, 0x64, 0x6f,
+    0x20, 0x61, 0x6f, 0x20, 0x57, 0x53, 0x20, 0x64, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x27, 0x29, 0x29, 0x3b, 0x0a, 0x77, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+    0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+    0x65, 0x27, 0x2c, 0x20, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x21,
+    0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+    0x6f, 0x66, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x29,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5b,
+    0x2c, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x64, 0x65, 0x63, 0x6f,
+    0x64, 0x65, 0x43, 0x62, 0x6f, 0x72, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x0a,
+    0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x2c, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x29, 0x3b, 0x0a, 0x69, 0x66,
+    0x20, 0x28, 0x27, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x27, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x20, 0x3d,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2e, 0x75, 0x70, 0x74, 0x69, 0x6d, 0x65, 0x3b, 0x0a, 0x75,
+    0x70, 0x74, 0x69, 0x6d, 0x65, 0x45, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74,
+    0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x74, 0x77, 0x6f, 0x28, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66,
+    0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x73, 0x20, 0x2f, 0x20, 0x33, 0x36, 0x30, 0x30, 0x29, 0x29, 0x20,
+    0x2b, 0x20, 0x27, 0x3a, 0x27, 0x20, 0x2b, 0x20, 0x74, 0x77, 0x6f, 0x28, 0x4d, 0x61, 0x74, 0x68,
+    0x2e, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x73, 0x20, 0x2f, 0x20, 0x36, 0x30, 0x29, 0x20, 0x25,
+    0x20, 0x36, 0x30, 0x29, 0x20, 0x2b, 0x20, 0x27, 0x3a, 0x27, 0x20, 0x2b, 0x20, 0x74, 0x77, 0x6f,
+    0x28, 0x73, 0x20, 0x25, 0x20, 0x36, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x29, 0x3b, 0x0a,
+    0x77, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20,
+    0x3d, 0x3e, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x27,
+    0x5b, 0x53, 0x69, 0x73, 0x74, 0x65, 0x6d, 0x61, 0x5d, 0x20, 0x43, 0x6f, 0x6e, 0x65, 0x78, 0xc3,
+    0xa3, 0x6f, 0x20, 0x57, 0x53, 0x20, 0x65, 0x6e, 0x63, 0x65, 0x72, 0x72, 0x61, 0x64, 0x61, 0x27,
+    0x29, 0x29, 0x3b, 0x0a, 0x77, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x27, 0x2c,
+    0x20, 0x65, 0x72, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x27, 0x5b, 0x45, 0x72, 0x72, 0x6f, 0x20, 0x57, 0x53, 0x5d,
+    0x27, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x29, 0x29, 0x3b, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70,
+    0x74, 0x3e, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+#define STATUS_BODY_LEN 2656
+#define STATUS_BODY_ETAG "\"d0e909ff547934a3\""
+
+static const uint8_t STATUS_BODY_GZ[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x56, 0x5d, 0x72, 0xdb, 0x36,
+    0x10, 0x7e, 0xf7, 0x29, 0x10, 0x79, 0x5a, 0x92, 0xb1, 0x48, 0x51, 0x7f, 0x8e, 0x4b, 0x4a, 0xea,
+    0xc4, 0x8e, 0x3b, 0x93, 0x99, 0x36, 0xe9, 0xc4, 0x4e, 0x33, 0x1d, 0x4f, 0x1e, 0x20, 0x72, 0x29,
+    0x21, 0x21, 0x01, 0x0d, 0x00, 0xfd, 0xd5, 0xd1, 0x19, 0x7a, 0x88, 0x3e, 0xf4, 0xb9, 0x67, 0xc8,
+    0x4d, 0x7a, 0x92, 0x2e, 0x00, 0x52, 0x92, 0x3b, 0xf6, 0xb4, 0x63, 0x9b, 0x26, 0x16, 0xdf, 0xee,
+    0x7e, 0xd8, 0x5d, 0xec, 0x72, 0xf4, 0xec, 0xd5, 0xdb, 0xab, 0xdb, 0x5f, 0x7f, 0xbe, 0x26, 0x73,
+    0x5d, 0x95, 0x93, 0x91, 0x79, 0x92, 0x92, 0xf2, 0xd9, 0xb8, 0xb5, 0xd0, 0xe1, 0xe5, 0xbb, 0x16,
+    0x8a, 0x80, 0xe6, 0x93, 0x51, 0x05, 0x9a, 0x92, 0x6c, 0x4e, 0xa5, 0x02, 0x3d, 0x6e, 0x2d, 0x75,
+    0x11, 0x5e, 0xb4, 0x6a, 0x29, 0xa7, 0x15, 0x8c, 0x5b, 0x2b, 0x06, 0xeb, 0x85, 0x90, 0xba, 0x45,
+    0x32, 0xc1, 0x35, 0x70, 0x44, 0xad, 0x59, 0xae, 0xe7, 0xe3, 0x1c, 0x56, 0x2c, 0x83, 0xd0, 0x2e,
+    0xda, 0x84, 0x71, 0xa6, 0x19, 0x2d, 0x43, 0x95, 0xd1, 0x12, 0xc6, 0xdd, 0x28, 0x46, 0x2b, 0x9a,
+    0xe9, 0x12, 0x26, 0x37, 0x9a, 0xea, 0xa5, 0x22, 0x39, 0x90, 0xeb, 0x0d, 0x64, 0xcb, 0xaf, 0x7f,
+    0x7e, 0xfd, 0x43, 0x8c, 0x3a, 0x6e, 0x6f, 0xa4, 0xf4, 0x16, 0xff, 0x4d, 0x45, 0xbe, 0xbd, 0x2f,
+    0xd0, 0x7c, 0x58, 0xd0, 0x8a, 0x95, 0xdb, 0xc4, 0xbb, 0x81, 0x99, 0x00, 0xf2, 0xfe, 0xb5, 0xd7,
+    0xbe, 0xa5, 0x73, 0x51, 0xd1, 0xb6, 0xa2, 0x5c, 0x85, 0x0a, 0x24, 0x2b, 0xd2, 0x29, 0xcd, 0x3e,
+    0xcf, 0xa4, 0x58, 0xf2, 0x3c, 0x39, 0x05, 0x28, 0x7a, 0xc5, 0x30, 0xcd, 0x44, 0x29, 0x64, 0x72,
+    0xda, 0xef, 0xf7, 0xd3, 0x9c, 0xa9, 0x45, 0x49, 0xb7, 0x49, 0x51, 0xc2, 0x26, 0x35, 0x8f, 0x30,
+    0x67, 0x12, 0x32, 0xcd, 0x04, 0x4f, 0x10, 0xb6, 0xac, 0x78, 0x4a, 0x4b, 0x36, 0xe3, 0x21, 0xd3,
+    0x50, 0xa9, 0x24, 0xc3, 0x13, 0x81, 0x4c, 0x17, 0x34, 0xcf, 0x19, 0x9f, 0x25, 0xbd, 0x78, 0xb1,
+    0x49, 0x2b, 0x2a, 0x67, 0x8c, 0x27, 0xf1, 0xce, 0x84, 0x08, 0xa4, 0x63, 0xa6, 0xd8, 0x6f, 0x90,
+    0x74, 0xa3, 0xa1, 0x84, 0xaa, 0x06, 0x84, 0x53, 0xa1, 0xb5, 0xa8, 0x92, 0xae, 0x11, 0xd5, 0x0c,
+    0x06, 0xf4, 0xbb, 0x18, 0x7a, 0xbb, 0xd3, 0xe5, 0x42, 0xb3, 0x0a, 0x8e, 0x34, 0x7b, 0x07, 0x3d,
+    0xeb, 0x84, 0xc4, 0x0f, 0xce, 0x51, 0x14, 0xc5, 0x9e, 0x43, 0xd7, 0x6c, 0x5b, 0x22, 0x53, 0x21,
+    0xd1, 0x7f, 0x28, 0x69, 0xce, 0x96, 0x2a, 0xb9, 0xb0, 0x92, 0x4d, 0xa8, 0xe6, 0x34, 0x17, 0xeb,
+    0x24, 0x26, 0x3d, 0xc4, 0x0d, 0xf0, 0x4f, 0xce, 0xa6, 0xd4, 0x8f, 0xdb, 0xf6, 0x27, 0xea, 0x06,
+    0xbb, 0xd3, 0x52, 0xcc, 0xee, 0x9b, 0x38, 0x70, 0xc1, 0x61, 0x37, 0xea, 0xb8, 0x40, 0x8f, 0x3a,
+    0x2e, 0xeb, 0x26, 0xe0, 0xae, 0x02, 0x40, 0x4e, 0xfe, 0xfe, 0xfd, 0x2f, 0x72, 0x0b, 0xd5, 0x42,
+    0x98, 0x1c, 0xbd, 0xd4, 0x6c, 0xc5, 0x72, 0x94, 0x3b, 0x28, 0x6e, 0x93, 0x51, 0xce, 0x56, 0x84,
+    0xe5, 0x58, 0x1d, 0xf6, 0x50, 0xad, 0x49, 0x18, 0x26, 0xf6, 0x77, 0xd4, 0xc1, 0x1d, 0xcc, 0x61,
+    0x26, 0xd9, 0x42, 0x4f, 0x8a, 0x25, 0xb7, 0x51, 0x46, 0x2b, 0x99, 0xc8, 0xe1, 0x0a, 0xc9, 0xfb,
+    0xd3, 0x65, 0x51, 0x80, 0x0c, 0xc8, 0xfd, 0x09, 0x16, 0x8f, 0xd2, 0xc4, 0x14, 0x13, 0x19, 0x13,
+    0x8e, 0xcf, 0x57, 0x54, 0xd3, 0x5f, 0x70, 0xd9, 0x60, 0xd2, 0x93, 0x12, 0x34, 0x59, 0x08, 0x85,
+    0xfb, 0x71, 0x5a, 0xe3, 0x31, 0x5e, 0xb8, 0xa4, 0x8c, 0x8c, 0x27, 0x68, 0x83, 0x15, 0xc4, 0xc7,
+    0xf7, 0x11, 0xe9, 0x0d, 0x02, 0x22, 0x41, 0x2f, 0x25, 0xc7, 0x3d, 0xa7, 0xb8, 0xa2, 0xe5, 0x12,
+    0x9c, 0x6a, 0x21, 0x24, 0xf1, 0x8d, 0x8c, 0xd9, 0x35, 0x31, 0x1a, 0x5d, 0x32, 0x1a, 0x59, 0xe5,
+    0xd0, 0x28, 0xa3, 0xec, 0xec, 0x2c, 0xd8, 0xeb, 0xb8, 0xff, 0xcf, 0x49, 0x6f, 0x78, 0x4e, 0xce,
+    0x2c, 0xc7, 0x68, 0x06, 0xfa, 0x3d, 0xe3, 0xfa, 0xc2, 0x47, 0x42, 0x08, 0x4d, 0x4f, 0x6a, 0x77,
+    0x16, 0x9a, 0x9e, 0xec, 0x1a, 0x82, 0xa6, 0x88, 0xd0, 0x82, 0x1f, 0x38, 0x86, 0xb5, 0x70, 0x6a,
+    0x8c, 0x3e, 0x62, 0xa6, 0x4d, 0x2a, 0xfa, 0x09, 0xd9, 0x8d, 0x0d, 0x64, 0x32, 0x21, 0xc3, 0xb6,
+    0x3d, 0x9b, 0x59, 0x7d, 0x4b, 0xfa, 0xdd, 0xd4, 0x9e, 0xb0, 0x86, 0x8c, 0xc7, 0xe4, 0x45, 0x70,
+    0x38, 0xb4, 0x59, 0xf7, 0x62, 0xf2, 0xe5, 0x0b, 0x69, 0x16, 0xdd, 0xa3, 0x18, 0xd4, 0x92, 0xf4,
+    0x01, 0xba, 0x77, 0x8c, 0xee, 0xef, 0xd1, 0x7c, 0x59, 0x96, 0x0f, 0x81, 0xc3, 0x43, 0x82, 0xe6,
+    0xff, 0x62, 0xde, 0x3d, 0x37, 0xd4, 0x91, 0xb8, 0x89, 0x93, 0x3f, 0x37, 0xa4, 0xbb, 0x71, 0x60,
+    0xd9, 0xb6, 0x49, 0x81, 0xb2, 0x39, 0xbe, 0x77, 0xe3, 0x5e, 0x3f, 0x3d, 0x31, 0xa9, 0x3b, 0x43,
+    0x6b, 0x4d, 0x68, 0x56, 0xb8, 0x0b, 0xd6, 0x41, 0x4c, 0xbe, 0x47, 0x2c, 0xc6, 0x97, 0x3c, 0x7f,
+    0x4e, 0xc2, 0xde, 0x80, 0x24, 0xf5, 0x46, 0xbf, 0x8b, 0x3b, 0x7e, 0x81, 0x8f, 0x37, 0xf4, 0x0d,
+    0x4a, 0x5f, 0xf3, 0xc2, 0xf4, 0x91, 0x6d, 0x80, 0xef, 0x3e, 0x5a, 0x1d, 0x60, 0x3a, 0x8a, 0xa0,
+    0xd1, 0xf4, 0xc1, 0x64, 0x6f, 0x78, 0x48, 0x86, 0xf1, 0x1d, 0x6f, 0x2e, 0xe2, 0xd8, 0x38, 0x08,
+    0x57, 0xa8, 0xb4, 0xc2, 0xd4, 0x3c, 0x38, 0xda, 0x39, 0x1e, 0x8d, 0xd4, 0xcc, 0x06, 0x69, 0x13,
+    0x82, 0xe6, 0x84, 0x3f, 0x94, 0x82, 0xea, 0x7e, 0xcf, 0x1c, 0x11, 0x4d, 0x9b, 0xba, 0x78, 0xa8,
+    0xfd, 0xe2, 0x48, 0xfb, 0xe2, 0x71, 0xed, 0xf3, 0x41, 0xad, 0x7d, 0x61, 0xb5, 0xf5, 0x5c, 0x8a,
+    0xb5, 0xad, 0xef, 0x6b, 0x29, 0xf1, 0x02, 0x78, 0x57, 0x97, 0x6f, 0xdf, 0x25, 0x44, 0xb1, 0x6a,
+    0x51, 0x02, 0xf1, 0xf0, 0x3c, 0x94, 0x05, 0x86, 0xa4, 0x8b, 0x11, 0x37, 0xd5, 0x2d, 0x67, 0xbe,
+    0x15, 0xaa, 0x35, 0xd3, 0xd9, 0xbc, 0x2e, 0x00, 0x9b, 0x12, 0xaa, 0x80, 0xc4, 0xc9, 0x3e, 0x71,
+    0xa9, 0x93, 0x74, 0xf7, 0x92, 0xb0, 0x8b, 0x8e, 0x1b, 0x71, 0x2f, 0x69, 0xa8, 0xf2, 0x3d, 0x55,
+    0x43, 0xc4, 0x16, 0xe0, 0x4b, 0x29, 0xe9, 0xb6, 0xbe, 0x6a, 0x6d, 0xe2, 0x18, 0xf3, 0x36, 0xe1,
+    0x41, 0xad, 0xdc, 0x7f, 0x42, 0xf9, 0x16, 0x36, 0xfa, 0x95, 0xbd, 0xcf, 0xd2, 0x0f, 0x22, 0x77,
+    0xb3, 0xfd, 0xff, 0xb6, 0xda, 0x98, 0x1d, 0xec, 0xa9, 0x5a, 0x68, 0x54, 0x48, 0x51, 0xf9, 0xf7,
+    0x25, 0xf0, 0x99, 0x9e, 0x27, 0x84, 0xef, 0xda, 0xf6, 0x02, 0x35, 0xe8, 0x61, 0x82, 0xe1, 0x76,
+    0x81, 0xa9, 0xe8, 0x02, 0x43, 0x73, 0xbf, 0x4b, 0xc9, 0x63, 0xb7, 0x99, 0xd7, 0x17, 0xb8, 0x41,
+    0x7f, 0x86, 0xad, 0xb9, 0x45, 0x68, 0xca, 0xc7, 0x2c, 0xa0, 0xee, 0x1d, 0x4a, 0x3e, 0x1e, 0x89,
+    0x76, 0x0d, 0x0d, 0xdc, 0x33, 0x69, 0xca, 0xa1, 0xa0, 0xcb, 0x52, 0xef, 0xd9, 0xd5, 0x38, 0xcc,
+    0xcb, 0x6e, 0x5f, 0x5d, 0x07, 0x99, 0x73, 0xa2, 0xd7, 0xc2, 0xb4, 0x2e, 0x73, 0xd1, 0x6f, 0xb4,
+    0xc4, 0x46, 0xed, 0xf3, 0x20, 0xc2, 0x9e, 0x8d, 0xf3, 0x4d, 0x6a, 0xbf, 0xd7, 0x26, 0x5e, 0xec,
+    0x05, 0x4d, 0xf1, 0xbb, 0x56, 0x79, 0x5d, 0xa2, 0x46, 0x2e, 0xb2, 0x65, 0x85, 0x53, 0xc6, 0x94,
+    0xcc, 0x75, 0x09, 0xe6, 0xf5, 0x72, 0xfb, 0x3a, 0xf7, 0x3d, 0x87, 0x39, 0xe8, 0x28, 0x1c, 0x94,
+    0xe0, 0x4e, 0x5d, 0x4b, 0xd6, 0xaa, 0x6e, 0x96, 0x1f, 0x60, 0x7a, 0x23, 0xb2, 0xcf, 0xa0, 0x7d,
+    0x6f, 0xad, 0x92, 0x4e, 0xc7, 0x14, 0x52, 0x29, 0x32, 0x6a, 0xfa, 0x6d, 0x34, 0x17, 0x08, 0x3d,
+    0x23, 0x5e, 0x47, 0xd9, 0x49, 0x6b, 0x0c, 0xae, 0x55, 0x34, 0x65, 0x9c, 0xca, 0xed, 0xed, 0x76,
+    0x61, 0x4c, 0x7a, 0xd4, 0x84, 0xdf, 0x25, 0xca, 0xb3, 0xdb, 0x38, 0x6b, 0xae, 0x57, 0x48, 0xe5,
+    0x47, 0xa6, 0x70, 0xa8, 0x63, 0x76, 0x3d, 0xb1, 0x00, 0xee, 0xb5, 0xeb, 0x56, 0x66, 0xfc, 0x8b,
+    0x12, 0x22, 0x9c, 0x24, 0xbe, 0x77, 0x77, 0x63, 0x40, 0x15, 0xfd, 0x48, 0xae, 0x70, 0x98, 0x64,
+    0x1a, 0xc7, 0x0f, 0xa1, 0x82, 0x7c, 0xb8, 0x31, 0x03, 0xa3, 0x71, 0x1a, 0x3c, 0x61, 0xb6, 0x02,
+    0xa5, 0xe8, 0x0c, 0x3c, 0xdb, 0x42, 0x9a, 0x2e, 0xfe, 0xcc, 0x87, 0x28, 0xc7, 0x01, 0x80, 0x9f,
+    0x0d, 0xa8, 0xcf, 0x33, 0x10, 0x85, 0xab, 0x90, 0x4b, 0x37, 0x0c, 0x9a, 0x66, 0xd5, 0x04, 0xe2,
+    0x0e, 0x9b, 0x0d, 0x83, 0x32, 0x57, 0x26, 0xa9, 0x47, 0xf3, 0xc5, 0x59, 0x41, 0xd7, 0x6f, 0xa7,
+    0x9f, 0x90, 0x58, 0x44, 0x95, 0xc2, 0xd1, 0xee, 0xdb, 0x48, 0x36, 0x2a, 0x81, 0x6b, 0x76, 0x4d,
+    0xb8, 0xd1, 0xa5, 0x8b, 0xf4, 0xa1, 0xe9, 0x99, 0x28, 0x5b, 0x51, 0xe4, 0x30, 0xe9, 0x49, 0x93,
+    0xbe, 0x48, 0x63, 0xfd, 0x5f, 0xb9, 0xef, 0x1e, 0x04, 0x61, 0x09, 0xf8, 0x3f, 0x51, 0x3d, 0x8f,
+    0x8a, 0x52, 0xa0, 0x77, 0x45, 0x3a, 0xa4, 0x7f, 0x1e, 0xc7, 0x48, 0x17, 0xc3, 0x9f, 0x98, 0xa4,
+    0x3c, 0x82, 0x38, 0xc7, 0x7e, 0xf9, 0x8d, 0x7d, 0x1e, 0x83, 0x94, 0x93, 0xd9, 0x92, 0x7b, 0x2a,
+    0x74, 0x59, 0x29, 0x14, 0xfc, 0x9f, 0x94, 0x6c, 0xf0, 0x93, 0xca, 0xa4, 0x03, 0x30, 0x92, 0x18,
+    0xc5, 0x9c, 0x3e, 0x9d, 0x0e, 0x30, 0x6d, 0xc9, 0x24, 0x43, 0xca, 0x63, 0xa3, 0xe0, 0xba, 0xd5,
+    0x9d, 0xe9, 0x5a, 0x68, 0xe9, 0xa3, 0x43, 0xa0, 0x15, 0xfc, 0x72, 0x70, 0xe3, 0x7d, 0xd4, 0x71,
+    0x1f, 0x0d, 0x1d, 0xfb, 0x41, 0xf9, 0x0f, 0x95, 0xdb, 0x41, 0x40, 0x60, 0x0a, 0x00, 0x00,
+};
+#define STATUS_BODY_GZ_LEN 1359
+#define STATUS_BODY_GZ_ETAG "\"4ef16110698c4bad\""
 
 #endif /* STATUS_H */
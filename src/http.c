@@ -1,41 +1,146 @@
+#include <stdarg.h>
+#include <strings.h>
 #include "http.h"
+#include "http_parser.h"
 #include "websocket.h"
+#include "ws_governor.h"
 
 
-#define HASHMAP_SEARCH
+// Route lookup: HASHMAP_SEARCH (default), LINEAR_DYNAMIC_ARRAY_SEARCH,
+// PERFECT_HASH_SEARCH (the table generated by htmltoh.py, read from flash;
+// routes added one by one go to the radix tree) or RADIX_TREE_SEARCH (every
+// route in the radix tree, no heap).
+// Patterns always go to the radix tree.
+// #define LINEAR_DYNAMIC_ARRAY_SEARCH
+// #define PERFECT_HASH_SEARCH
+// #define RADIX_TREE_SEARCH
+#if !defined(LINEAR_DYNAMIC_ARRAY_SEARCH) && !defined(PERFECT_HASH_SEARCH) && !defined(RADIX_TREE_SEARCH)
+    #define HASHMAP_SEARCH
+#endif
+
 #ifdef HASHMAP_SEARCH
     #define STB_DS_IMPLEMENTATION
     #include "stb_ds.h"
 #endif
 
-// #define LINEAR_DYNAMIC_ARRAY_SEARCH
-
 static http_routes_t* http_routes = NULL;
-static new_schemas_routes_t* new_schemas_routes = NULL;
+static new_schemas_routes_t new_schemas_routes_table = {0};
+static new_schemas_routes_t* new_schemas_routes = &new_schemas_routes_table;
+static http_static_routes_t http_static_routes = {0};
 static http_routes_hashmap_t* http_routes_hmap = NULL;
+static http_pattern_routes_t http_pattern_routes = {0};
+static http_router_t http_router = {0};
+static http_router_t http_body_router = {0};
+#ifdef PERFECT_HASH_SEARCH
+static const http_route_table_t* http_routes_table = NULL;
+static size_t http_routes_table_base = 0;   // static response of the first entry
+#endif
 static new_schemas_hashmap_t* new_schemas_hmap = NULL;
 
 char http_response[HTTP_RESPONSE_BUFFER_SIZE];
 char payload_temp_buff[PAYLOAD_TEMP_BUFFER_SIZE];
-const char* new_schema_http_header_field = {"Upgrade: "};
-
-char resp302[KB(1) / 2];
-const char* captive_site_routes[] = {"GET /generate_204","GET /hotspot-detect.html","GET /connecttest.txt","GET /redirect"};
-bool dns_captive_site_response(struct tcp_pcb *tpcb,struct pbuf *p,char* payload){
-    bool in_captive_site_routes = false;
-    for (int i = 0; i < count_of(captive_site_routes); i++){
-        in_captive_site_routes = in_captive_site_routes || strstr(payload,captive_site_routes[i]);
-    }
-    if(in_captive_site_routes){
-        int r = snprintf(resp302, sizeof(resp302),DNS_CAPTIVE_RESPONSE_HEADER,dnss_captive_site);
-        tcp_write(tpcb, resp302, r, TCP_WRITE_FLAG_COPY);
-        tcp_output(tpcb);
+
+// Response body still being sent, refilled from tcp_sent
+typedef struct {
+    const char* data;                  // flash source, NULL for a generator
+    http_body_generator_t generator;
+    void* generator_arg;
+    size_t len;                        // HTTP_BODY_CHUNKED until the producer ends it
+    size_t pos;
+    bool chunked;                      // framed in chunks (HTTP/1.1 clients)
+} http_stream_t;
+
+// Request body being read, see add_http_body_route
+typedef struct {
+    const http_body_handler_t* handler;   // NULL when no body is being read
+    void* ctx;
+    bool keep_alive;                      // decided from the request head
+    http_body_parser_t parser;
+} http_body_t;
+
+// Response being written by a route_writer_handler_t
+enum {
+    HTTP_WRITER_IDLE,
+    HTTP_WRITER_BUFFERING,    // nothing sent yet: may still get a Content-Length
+    HTTP_WRITER_CHUNKED,      // head sent, body in chunks
+    HTTP_WRITER_RAW           // head sent, body delimited by the close (HTTP/1.0)
+};
+
+struct http_writer {
+    struct http_conn* conn;   // connection the response belongs to
+    struct tcp_pcb* pcb;
+    uint32_t generation;      // of this response, 0 while idle (http_writer_ref_t)
+    char* buf;                // HTTP_WRITER_BUFFER_SIZE bytes from http_writer_pool
+    const char* status;
+    uint16_t head_len;        // header lines at the start of buf
+    uint16_t len;             // bytes of buf in use (header lines and body)
+    uint8_t state;
+    bool chunked_ok;          // the client speaks HTTP/1.1
+    bool keep_alive;
+    bool has_type;
+    bool has_cache;
+    bool ending;              // http_end() called, waiting for room to finish
+    bool dispatching;         // inside a handler or drain callback
+    http_writer_drain_t drain;
+    void* drain_arg;
+};
+
+// Per-connection state, handed to the callbacks through tcp_arg
+typedef struct http_conn {
+    struct tcp_pcb* pcb;
+    uint8_t requests;     // requests answered on this connection
+    uint8_t idle_polls;   // tcp_poll intervals since data last arrived
+    uint8_t head_polls;   // tcp_poll intervals spent on the current request head
+    bool reading_head;    // a request head is expected or partly received
+    bool close_after;     // close once the stream is sent
+    http_stream_t stream;
+    struct pbuf* pending; // pipelined requests waiting for the stream, or the
+    uint16_t pending_offset;  // rest of a body its handler has paused
+    http_body_t body;
+    http_writer_t writer;
+    http_parser_t parser;
+} http_conn_t;
+
+// Generators write here; the bytes are copied into lwIP right away
+static char http_stream_chunk[HTTP_STREAM_CHUNK_SIZE];
+
+static const char http_crlf[] = "\r\n";
+static const char http_last_chunk[] = "0\r\n\r\n";
+static const size_t http_chunk_framing = 8;    // "ffff\r\n" before the data, "\r\n" after
+
+WS_POOL_DEFINE(http_conn_pool, sizeof(http_conn_t), HTTP_MAX_CONNECTIONS);
+// Open connections, to pick one to evict when the pool is exhausted
+static http_conn_t* http_conns[HTTP_MAX_CONNECTIONS];
+WS_POOL_DEFINE(http_writer_pool, HTTP_WRITER_BUFFER_SIZE, HTTP_MAX_WRITERS);
+static uint32_t http_writer_generation = 0;
+
+// Routes of the radix tree live in a fixed table; the tree points at them
+static void http_register_pattern_route(const char* route_path, route_response_handler_t route_response_handler,
+                                        route_param_handler_t route_param_handler, route_writer_handler_t route_writer_handler,
+                                        const http_static_response_t* static_response){
+    if (http_pattern_routes.count >= HTTP_MAX_PATTERN_ROUTES) {
+        printf("Erro: limite de %d rotas com padrao atingido\n", HTTP_MAX_PATTERN_ROUTES);
+        return;
     }
-    return in_captive_site_routes;
-}
+    if (http_router.count == 0) http_router_init(&http_router);
 
+    http_route_item_t* item = &http_pattern_routes.items[http_pattern_routes.count];
+    *item = (http_route_item_t){strlen(route_path),route_response_handler,static_response,route_param_handler,route_writer_handler};
+    if (http_router_add(&http_router, route_path, item)) http_pattern_routes.count++;
+}
 
-void add_http_route(const char* route_path, route_response_handler_t route_response_handler){
+static void http_register_route(const char* route_path, route_response_handler_t route_response_handler,
+                                route_param_handler_t route_param_handler, route_writer_handler_t route_writer_handler,
+                                const http_static_response_t* static_response){
+    #ifndef RADIX_TREE_SEARCH
+        if (http_router_is_pattern(route_path)) {
+            http_register_pattern_route(route_path, route_response_handler, route_param_handler, route_writer_handler, static_response);
+            return;
+        }
+    #endif
+    #if defined(RADIX_TREE_SEARCH) || defined(PERFECT_HASH_SEARCH)
+        http_register_pattern_route(route_path, route_response_handler, route_param_handler, route_writer_handler, static_response);
+    #endif
     #ifdef LINEAR_DYNAMIC_ARRAY_SEARCH
         if(http_routes == NULL){
             http_routes = (http_routes_t*)calloc(1,sizeof(http_routes_t));
@@ -46,96 +151,958 @@ void add_http_route(const char* route_path, route_response_handler_t route_respo
             else http_routes->capacity *= 2;                                                
             http_routes->items = realloc(http_routes->items, http_routes->capacity*sizeof(*http_routes->items)); 
         }                                           
-        http_routes->items[http_routes->count++] = (http_route_t){route_path,strlen(route_path),route_response_handler};
+        http_routes->items[http_routes->count++] = (http_route_t){route_path,strlen(route_path),route_response_handler,static_response,route_param_handler,route_writer_handler};
     #endif
     #ifdef HASHMAP_SEARCH
-        http_route_item_t item = (http_route_item_t){strlen(route_path),route_response_handler};
+        http_route_item_t item = (http_route_item_t){strlen(route_path),route_response_handler,static_response,route_param_handler,route_writer_handler};
         shput(http_routes_hmap,route_path,item);
     #endif
+}
+
+void add_http_route(const char* route_path, route_response_handler_t route_response_handler){
+    http_register_route(route_path, route_response_handler, NULL, NULL, NULL);
+};
+
+void add_http_param_route(const char* route_path, route_param_handler_t route_param_handler){
+    http_register_route(route_path, NULL, route_param_handler, NULL, NULL);
+};
+
+void add_http_writer_route(const char* route_path, route_writer_handler_t route_writer_handler){
+    http_register_route(route_path, NULL, NULL, route_writer_handler, NULL);
+};
+
+void add_http_body_route(const char* route_path, const http_body_handler_t* handler){
+    if (http_body_router.count == 0) http_router_init(&http_body_router);
+    http_router_add(&http_body_router, route_path, handler);
 };
 
+static http_static_response_t* http_static_response_new(const char* route_path, const char* content_type, size_t body_len, size_t gzip_len,
+                                                         const char* etag, const char* gzip_etag){
+    if (http_static_routes.count >= HTTP_MAX_STATIC_ROUTES) {
+        printf("Erro: limite de %d rotas estaticas atingido\n", HTTP_MAX_STATIC_ROUTES);
+        return NULL;
+    }
+
+    http_static_response_t* resp = &http_static_routes.items[http_static_routes.count];
+    memset(resp, 0, sizeof(*resp));
+    // With a validator the browser may keep the page but must revalidate it
+    int len = snprintf(resp->header, sizeof(resp->header),
+        LB("HTTP/1.1 200 OK")
+        LB("Content-Type: %s")
+        LB("Cache-Control: %s")
+        "%s",
+        content_type, etag ? "no-cache" : "no-cache, no-store, must-revalidate",
+        gzip_len ? LB("Vary: Accept-Encoding") : "");
+    int length_len = snprintf(resp->length, sizeof(resp->length), "%s%s%s" LB("Content-Length: %u"),
+        etag ? "ETag: " : "", etag ? etag : "", etag ? "\r\n" : "", (unsigned)body_len);
+    int gzip_length_len = snprintf(resp->gzip_length, sizeof(resp->gzip_length), LB("Content-Encoding: gzip") "%s%s%s" LB("Content-Length: %u"),
+        gzip_etag ? "ETag: " : "", gzip_etag ? gzip_etag : "", gzip_etag ? "\r\n" : "", (unsigned)gzip_len);
+    if (len < 0 || (size_t)len >= sizeof(resp->header) ||
+        length_len < 0 || (size_t)length_len >= sizeof(resp->length) ||
+        gzip_length_len < 0 || (size_t)gzip_length_len >= sizeof(resp->gzip_length)) {
+        printf("Erro: cabecalho da rota %s muito longo\n", route_path);
+        return NULL;
+    }
+    resp->header_len = len;
+    resp->body_len = body_len;
+    resp->length_len = length_len;
+    resp->gzip_len = gzip_len;
+    resp->gzip_length_len = gzip_length_len;
+    resp->etag = etag;
+    resp->gzip_etag = gzip_etag;
+
+    http_static_routes.count++;
+    return resp;
+}
+
+void add_http_static_route(const char* route_path, const char* content_type, const char* body, size_t body_len){
+    add_http_static_route_gz(route_path, content_type, body, body_len, NULL, 0, NULL, NULL);
+};
+
+void add_http_static_route_gz(const char* route_path, const char* content_type, const char* body, size_t body_len,
+                              const uint8_t* gzip_body, size_t gzip_len, const char* etag, const char* gzip_etag){
+    http_static_response_t* resp = http_static_response_new(route_path, content_type, body_len, gzip_body ? gzip_len : 0,
+                                                            etag, gzip_body ? gzip_etag : NULL);
+    if (!resp) return;
+    resp->body = body;
+    resp->gzip_body = gzip_body;
+    http_register_route(route_path, NULL, NULL, NULL, resp);
+};
+
+void add_http_generator_route(const char* route_path, const char* content_type, size_t body_len, http_body_generator_t generator, void* arg){
+    http_static_response_t* resp = http_static_response_new(route_path, content_type, body_len, 0, NULL, NULL);
+    if (!resp) return;
+    resp->generator = generator;
+    resp->generator_arg = arg;
+    http_register_route(route_path, NULL, NULL, NULL, resp);
+};
+
+void add_http_chunked_route(const char* route_path, const char* content_type, http_chunk_producer_t producer, void* arg){
+    http_static_response_t* resp = http_static_response_new(route_path, content_type, HTTP_BODY_CHUNKED, 0, NULL, NULL);
+    if (!resp) return;
+    resp->length_len = snprintf(resp->length, sizeof(resp->length), LB("Transfer-Encoding: chunked"));
+    resp->generator = producer;
+    resp->generator_arg = arg;
+    http_register_route(route_path, NULL, NULL, NULL, resp);
+};
+
+void add_http_assets(const http_asset_t* assets, size_t count){
+    for (size_t ii = 0; ii < count; ii++) {
+        const http_asset_t* a = &assets[ii];
+        add_http_static_route_gz(a->route_path, a->content_type, (const char*)a->body, a->body_len,
+                                 a->gzip_body, a->gzip_len, a->etag, a->gzip_etag);
+    }
+};
+
+void add_http_route_table(const http_route_table_t* table){
+    #ifdef PERFECT_HASH_SEARCH
+        // Entry i of the table is served by static response base + i
+        size_t base = http_static_routes.count;
+        for (size_t ii = 0; ii < table->count; ii++) {
+            const http_asset_t* a = &table->assets[ii];
+            http_static_response_t* resp = http_static_response_new(a->route_path, a->content_type, a->body_len,
+                                                                    a->gzip_body ? a->gzip_len : 0,
+                                                                    a->etag, a->gzip_body ? a->gzip_etag : NULL);
+            if (!resp) {
+                http_static_routes.count = base;
+                return;
+            }
+            resp->body = (const char*)a->body;
+            resp->gzip_body = a->gzip_body;
+        }
+        http_routes_table = table;
+        http_routes_table_base = base;
+    #else
+        add_http_assets(table->assets, table->count);
+    #endif
+};
+
+#ifdef PERFECT_HASH_SEARCH
+static const http_static_response_t* http_route_table_find(const char* path){
+    const http_route_table_t* table = http_routes_table;
+    if (!table || table->count == 0) return NULL;
+
+    size_t len = strlen(path);
+    uint32_t h = http_route_hash(path, len, table->seed);
+    uint32_t d = table->displace[http_route_reduce(h, table->buckets)];
+    const http_route_slot_t* slot = &table->slots[http_route_reduce(http_route_mix(h ^ d), table->count)];
+    if (slot->route_path_len != len || memcmp(slot->route_path, path, len) != 0) return NULL;
+    return &http_static_routes.items[http_routes_table_base + slot->asset];
+}
+#endif
+
 // NEW SCHEMAS ROUTES SHOULD INHERIT THE CONNECTION FROM THE HTTP CALLBACK HANDLER TROUGH "Upgrade" FIELD
 // ONCE THE HANDLER IS CALLED THE HTTP CALLBACK SHOULD BE REMOVED FROM THE TCP_RECV
 void add_new_schema_route(const char* new_schema, new_schema_handler_t new_schema_handler){
-    if(new_schemas_routes == NULL){
-        new_schemas_routes = (new_schemas_routes_t*)calloc(1,sizeof(new_schemas_routes_t));
-    } 
-    
-    if (new_schemas_routes->count >= new_schemas_routes->capacity) {                                         
-        if (new_schemas_routes->capacity == 0) new_schemas_routes->capacity = 4;                           
-        else new_schemas_routes->capacity *= 2;                                                
-        new_schemas_routes->items = realloc(new_schemas_routes->items, new_schemas_routes->capacity*sizeof(*new_schemas_routes->items)); 
+    if (new_schemas_routes->count >= HTTP_MAX_NEW_SCHEMAS) {
+        printf("Erro: limite de %d esquemas atingido\n", HTTP_MAX_NEW_SCHEMAS);
+        return;
     }
-    
-    size_t len = strlen(new_schema)+sizeof(new_schema_http_header_field)+1;
-    char* new_schema_with_upgrade = (char*)calloc(1,len);
-    snprintf(new_schema_with_upgrade, len, "%s%s", new_schema_http_header_field, new_schema);
 
-    new_schemas_routes->items[new_schemas_routes->count++] = (new_schema_route_t){new_schema_with_upgrade,new_schema_handler};
+    new_schema_route_t* item = &new_schemas_routes->items[new_schemas_routes->count++];
+    snprintf(item->new_schema, sizeof(item->new_schema), "%s", new_schema);
+    item->new_schema_handler = new_schema_handler;
 };
 
-static err_t http_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
-    if (p == NULL) {
-        if (tpcb->state != CLOSED && tpcb->state != TIME_WAIT) tcp_close(tpcb);
-        return ERR_OK;
+static void http_body_abort(http_conn_t* conn){
+    http_body_t* body = &conn->body;
+    if (body->handler && body->handler->on_abort) body->handler->on_abort(body->ctx);
+    body->handler = NULL;
+}
+
+static void http_writer_release(http_writer_t* w){
+    ws_pool_free(&http_writer_pool, w->buf);
+    w->buf = NULL;
+    w->state = HTTP_WRITER_IDLE;
+    w->generation = 0;
+}
+
+// Connection lost with the response unfinished: the drain callback hears of it
+static void http_writer_abort(http_writer_t* w){
+    if (w->state == HTTP_WRITER_IDLE) return;
+    http_writer_drain_t drain = w->drain;
+    http_writer_release(w);
+    if (drain) drain(NULL, w->drain_arg);
+}
+
+static void http_conn_free(http_conn_t* conn){
+    if (conn) http_body_abort(conn);
+    if (conn) http_writer_abort(&conn->writer);
+    if (conn && conn->pending) pbuf_free(conn->pending);
+    for (size_t ii = 0; conn && ii < HTTP_MAX_CONNECTIONS; ii++) {
+        if (http_conns[ii] == conn) http_conns[ii] = NULL;
     }
-    tcp_recved(tpcb, p->tot_len);
+    ws_pool_free(&http_conn_pool, conn);
+}
 
-    int len = p->tot_len < sizeof(payload_temp_buff) - 1
-                  ? p->tot_len
-                  : sizeof(payload_temp_buff) - 1;
-    
-    memcpy(payload_temp_buff, p->payload, len);
-    payload_temp_buff[len] = '\0';
-    
-    
-    for (size_t i = 0; i < new_schemas_routes->count; ++i){
-        if(strstr(payload_temp_buff,new_schemas_routes->items[i].new_schema)){
-            return new_schemas_routes->items[i].new_schema_handler(payload_temp_buff,tpcb,p);
+static void http_conn_release(struct tcp_pcb *tpcb, http_conn_t* conn){
+    // Requests held back will never be read: reopen the window they took
+    if (conn->pending) tcp_recved(tpcb, conn->pending->tot_len - conn->pending_offset);
+    tcp_arg(tpcb, NULL);
+    tcp_err(tpcb, NULL);
+    tcp_poll(tpcb, NULL, 0);
+    tcp_sent(tpcb, NULL);
+    http_conn_free(conn);
+}
+
+// tcp_close() resets a connection whose receive window is not fully open,
+// purging the response still queued: every byte received must have been
+// credited with tcp_recved() by then
+static err_t http_close(struct tcp_pcb *tpcb, http_conn_t* conn){
+    if (conn) http_conn_release(tpcb, conn);
+    tcp_output(tpcb);
+    if (tcp_close(tpcb) != ERR_OK) {
+        tcp_abort(tpcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+// Frees `p`, crediting the bytes from `offset` on, which will not be read
+static void http_discard(struct tcp_pcb *tpcb, struct pbuf* p, uint16_t offset){
+    if (!p) return;
+    if (offset < p->tot_len) tcp_recved(tpcb, p->tot_len - offset);
+    pbuf_free(p);
+}
+
+// A lingering connection is closed for good on its first poll
+static err_t http_linger_poll(void *arg, struct tcp_pcb *tpcb){
+    return http_close(tpcb, NULL);
+}
+
+// Closes after a response while the client may still be sending (a body
+// nobody reads, pipelined requests, the rest of a bad request). Only our
+// side is shut: what still arrives is credited and dropped by
+// http_callback, where tcp_close() would answer it with a reset and lose
+// the response. The connection is closed when the client closes too, or
+// after HTTP_KEEPALIVE_TIMEOUT_S.
+static err_t http_close_lingering(struct tcp_pcb *tpcb, http_conn_t* conn, struct pbuf* p, uint16_t offset){
+    http_discard(tpcb, p, offset);
+    if (conn) http_conn_release(tpcb, conn);
+    tcp_poll(tpcb, http_linger_poll, HTTP_KEEPALIVE_TIMEOUT_S * 2);
+    tcp_output(tpcb);
+    if (tcp_shutdown(tpcb, 0, 1) != ERR_OK) {
+        tcp_abort(tpcb);
+        return ERR_ABRT;
+    }
+    return ERR_OK;
+}
+
+// The pcb is already gone when lwIP reports an error
+static void http_err_callback(void *arg, err_t err){
+    http_conn_free(arg);
+}
+
+static bool http_stream_active(http_conn_t* conn){
+    return conn->stream.pos < conn->stream.len;
+}
+
+// A streamed body or a writer still in progress
+static bool http_response_active(http_conn_t* conn){
+    return http_stream_active(conn) || conn->writer.state != HTTP_WRITER_IDLE;
+}
+
+// One chunk: size line, data and CRLF, all copied so lwIP packs consecutive
+// chunks into full segments. ERR_MEM only if nothing was queued.
+static err_t http_stream_write_chunk(struct tcp_pcb *tpcb, const char* data, size_t len){
+    char size[8];
+    int size_len = snprintf(size, sizeof(size), "%x\r\n", (unsigned)len);
+    err_t err = tcp_write(tpcb, size, size_len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+    if (err != ERR_OK) return err;
+    if (tcp_write(tpcb, data, len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE) != ERR_OK ||
+        tcp_write(tpcb, http_crlf, 2, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE) != ERR_OK) return ERR_VAL;
+    return ERR_OK;
+}
+
+// Queues as much of the body as the copy window allows. Every byte written
+// is copied into the lwIP heap (flash data too, see lwipopts.h), so at most
+// HTTP_STREAM_COPY_WINDOW bytes of a response are kept in flight and one
+// large page cannot take the heap from the other connections. Chunked
+// bodies get chunks sized to the room left, until the producer returns 0.
+// Returns false if the response cannot be completed.
+static bool http_stream_pump(struct tcp_pcb *tpcb, http_conn_t* conn){
+    http_stream_t* st = &conn->stream;
+
+    while (http_stream_active(conn)) {
+        size_t room = tcp_sndbuf(tpcb);
+        size_t in_flight = TCP_SND_BUF - room;
+        if (in_flight >= HTTP_STREAM_COPY_WINDOW) break;
+        if (room > HTTP_STREAM_COPY_WINDOW - in_flight) room = HTTP_STREAM_COPY_WINDOW - in_flight;
+        if (st->generator) {
+            if (st->chunked) {
+                if (room <= http_chunk_framing) break;
+                room -= http_chunk_framing;
+            }
+            if (room > sizeof(http_stream_chunk)) room = sizeof(http_stream_chunk);
+        }
+        size_t n = st->len - st->pos;
+        if (n > room) n = room;
+        if (n > 0xFFFF) n = 0xFFFF;
+        if (n == 0 || tcp_sndqueuelen(tpcb) + (st->chunked ? 3 : 1) > TCP_SND_QUEUELEN) break;
+
+        err_t err;
+        if (st->generator) {
+            n = st->generator(st->pos, http_stream_chunk, n, st->generator_arg);
+            if (n > sizeof(http_stream_chunk)) return false;
+            if (n == 0) {
+                if (st->len != HTTP_BODY_CHUNKED) return false;
+                // End of a body of unknown length (HTTP/1.0: the close ends it)
+                err = st->chunked ? tcp_write(tpcb, http_last_chunk, sizeof(http_last_chunk) - 1, 0) : ERR_OK;
+                if (err == ERR_MEM) break;
+                if (err != ERR_OK) return false;
+                st->len = st->pos;
+                break;
+            }
+            if (st->chunked) {
+                err = http_stream_write_chunk(tpcb, http_stream_chunk, n);
+            } else {
+                err = tcp_write(tpcb, http_stream_chunk, n, TCP_WRITE_FLAG_COPY | (st->pos + n < st->len ? TCP_WRITE_FLAG_MORE : 0));
+            }
+        } else {
+            err = tcp_write(tpcb, st->data + st->pos, n, st->pos + n < st->len ? TCP_WRITE_FLAG_MORE : 0);
         }
+        // Out of segments or heap: retried when acknowledgements free some
+        if (err == ERR_MEM) break;
+        if (err != ERR_OK) return false;
+        st->pos += n;
     }
-    
-    char *line_end = strstr(payload_temp_buff, "\r\n");
-    if (!line_end) line_end = payload_temp_buff + len;
-    *line_end = '\0';
-    
-    
-    char method[8], path[256];
-    char query_parameters[512] = {0};
-    char *query_params_point = strstr(payload_temp_buff, "?");
 
-    if(query_params_point){
-        *query_params_point = ' ';
-        if (sscanf(payload_temp_buff, "%7s %255s %511s", method, path, query_parameters) != 3) {
-            goto send_404;
+    if (!http_stream_active(conn)) conn->stream = (http_stream_t){0};
+    return true;
+}
+
+static bool http_send_status(struct tcp_pcb *tpcb, const char* status, bool keep_alive){
+    char resp[112];
+    int len = snprintf(resp, sizeof(resp),
+        "HTTP/1.1 %s\r\n"
+        "Connection: %s\r\n"
+        "Content-Length: 0\r\n"
+        "\r\n", status, keep_alive ? "keep-alive" : "close");
+    return tcp_write(tpcb, resp, len, TCP_WRITE_FLAG_COPY) == ERR_OK && keep_alive;
+}
+
+// Sends a handler's response, adding the framing a persistent connection
+// needs: Content-Length (unless the handler set it) and a Connection header.
+// Returns whether the connection can stay open.
+static bool http_send_response(struct tcp_pcb *tpcb, char* response, bool keep_alive){
+    size_t len = strlen(response);
+    char* end = strstr(response, "\r\n\r\n");
+    if (!end) {
+        tcp_write(tpcb, response, len, TCP_WRITE_FLAG_COPY);
+        return false;
+    }
+
+    size_t head_len = end - response + 2;
+    const char* body = end + 4;
+    size_t body_len = len - (body - response);
+
+    response[head_len] = '\0';
+    bool has_length = strstr(response, "Content-Length:") != NULL;
+    if (strstr(response, "Connection: close")) keep_alive = false;
+    bool has_connection = strstr(response, "Connection:") != NULL;
+    response[head_len] = '\r';
+
+    char extra[64];
+    int extra_len = 0;
+    if (!has_length) {
+        extra_len += snprintf(extra + extra_len, sizeof(extra) - extra_len, "Content-Length: %u\r\n", (unsigned)body_len);
+    }
+    if (!has_connection) {
+        extra_len += snprintf(extra + extra_len, sizeof(extra) - extra_len, "Connection: %s\r\n", keep_alive ? "keep-alive" : "close");
+    }
+    extra_len += snprintf(extra + extra_len, sizeof(extra) - extra_len, "\r\n");
+
+    if (tcp_write(tpcb, response, head_len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE) != ERR_OK ||
+        tcp_write(tpcb, extra, extra_len, TCP_WRITE_FLAG_COPY | (body_len ? TCP_WRITE_FLAG_MORE : 0)) != ERR_OK ||
+        (body_len && tcp_write(tpcb, body, body_len, TCP_WRITE_FLAG_COPY) != ERR_OK)) {
+        return false;
+    }
+    return keep_alive;
+}
+
+static bool http_writer_room(http_writer_t* w, size_t bytes, size_t writes){
+    return tcp_sndbuf(w->pcb) >= bytes && tcp_sndqueuelen(w->pcb) + writes <= TCP_SND_QUEUELEN;
+}
+
+static err_t http_response_done(struct tcp_pcb *tpcb, http_conn_t* conn);
+
+// Part of the response was queued and the rest refused: its framing is
+// broken, so the connection is closed, as for a streamed chunk. Inside our
+// callbacks the caller closes it once the writer is idle.
+static void http_writer_fail(http_writer_t* w){
+    http_conn_t* conn = w->conn;
+    w->keep_alive = false;
+    conn->close_after = true;
+    http_writer_abort(w);
+    if (!w->dispatching) http_response_done(conn->pcb, conn);
+}
+
+typedef struct {
+    const void* data;
+    size_t len;
+    u8_t flags;
+} http_writer_piece_t;
+
+// Queues the pieces back to back. False with nothing queued while the send
+// buffer is too full; any other failure fails the writer.
+static bool http_writer_queue(http_writer_t* w, const http_writer_piece_t* pieces, size_t count){
+    bool queued = false;
+    for (size_t i = 0; i < count; i++) {
+        if (pieces[i].len == 0) continue;
+        err_t err = tcp_write(w->pcb, pieces[i].data, pieces[i].len, pieces[i].flags);
+        if (err == ERR_OK) {
+            queued = true;
+            continue;
+        }
+        if (queued || err != ERR_MEM) http_writer_fail(w);
+        return false;
+    }
+    return true;
+}
+
+// Status line, the staged header lines, `framing` and the blank line, then
+// `body` if any, all in one go
+static bool http_writer_send_head(http_writer_t* w, const char* framing, const char* body, size_t body_len){
+    char line[128];
+    int len = snprintf(line, sizeof(line), "HTTP/1.1 %s\r\n%s%s", w->status,
+        w->has_type ? "" : LB("Content-Type: text/html; charset=UTF-8"),
+        w->has_cache ? "" : LB("Cache-Control: no-cache, no-store, must-revalidate"));
+    char end[64];
+    int end_len = snprintf(end, sizeof(end), "%sConnection: %s\r\n\r\n", framing, w->keep_alive ? "keep-alive" : "close");
+    if (len < 0 || (size_t)len >= sizeof(line) || end_len < 0 || (size_t)end_len >= sizeof(end)) return false;
+    if (!http_writer_room(w, len + w->head_len + end_len + body_len, body_len ? 4 : 3)) return false;
+
+    http_writer_piece_t pieces[] = {
+        {line, len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE},
+        {w->buf, w->head_len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE},
+        {end, end_len, TCP_WRITE_FLAG_COPY | (body_len ? TCP_WRITE_FLAG_MORE : 0)},
+        {body, body_len, TCP_WRITE_FLAG_COPY}
+    };
+    return http_writer_queue(w, pieces, count_of(pieces));
+}
+
+// Sends the head before the first chunk: chunked for HTTP/1.1 clients,
+// delimited by closing the connection for HTTP/1.0 ones
+static bool http_writer_commit(http_writer_t* w){
+    if (w->state != HTTP_WRITER_BUFFERING) return true;
+    if (!w->chunked_ok) w->keep_alive = false;
+    if (!http_writer_send_head(w, w->chunked_ok ? LB("Transfer-Encoding: chunked") : "", NULL, 0)) return false;
+
+    // The header lines are gone; keep only the body
+    memmove(w->buf, w->buf + w->head_len, w->len - w->head_len);
+    w->len -= w->head_len;
+    w->head_len = 0;
+    w->state = w->chunked_ok ? HTTP_WRITER_CHUNKED : HTTP_WRITER_RAW;
+    return true;
+}
+
+// Queues `len` body bytes as they are framed after the head
+static bool http_writer_send_body(http_writer_t* w, const void* data, size_t len, u8_t copy){
+    if (len == 0) return true;
+    if (w->state == HTTP_WRITER_RAW) {
+        return http_writer_room(w, len, 1) && tcp_write(w->pcb, data, len, copy) == ERR_OK;
+    }
+    char size[12];
+    int size_len = snprintf(size, sizeof(size), "%x\r\n", (unsigned)len);
+    http_writer_piece_t pieces[] = {
+        {size, size_len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE},
+        {data, len, copy | TCP_WRITE_FLAG_MORE},
+        {http_crlf, 2, 0}
+    };
+    return http_writer_room(w, size_len + len + 2, 3) && http_writer_queue(w, pieces, count_of(pieces));
+}
+
+// Empties the staging buffer into the send queue, if it has room
+static bool http_writer_flush(http_writer_t* w){
+    if (!http_writer_commit(w)) return false;
+    if (!http_writer_send_body(w, w->buf, w->len, TCP_WRITE_FLAG_COPY)) return false;
+    w->len = 0;
+    return true;
+}
+
+// Queues everything left. False while the send buffer is too full.
+static bool http_writer_finish(http_writer_t* w){
+    if (w->state == HTTP_WRITER_BUFFERING) {
+        char length[32];
+        snprintf(length, sizeof(length), "Content-Length: %u\r\n", (unsigned)(w->len - w->head_len));
+        // Head and body go out together or not at all
+        if (!http_writer_room(w, w->len + 128 + 64, 4) ||
+            !http_writer_send_head(w, length, w->buf + w->head_len, w->len - w->head_len)) return false;
+    } else {
+        if (!http_writer_flush(w)) return false;
+        if (w->state == HTTP_WRITER_CHUNKED &&
+            (!http_writer_room(w, sizeof(http_last_chunk) - 1, 1) ||
+             tcp_write(w->pcb, http_last_chunk, sizeof(http_last_chunk) - 1, 0) != ERR_OK)) return false;
+    }
+    if (!w->keep_alive) w->conn->close_after = true;
+    http_writer_release(w);
+    return true;
+}
+
+void http_writer_status(http_writer_t* w, const char* status){
+    if (w->state == HTTP_WRITER_BUFFERING && w->len == w->head_len) w->status = status;
+}
+
+bool http_writer_header(http_writer_t* w, const char* name, const char* value){
+    if (w->state != HTTP_WRITER_BUFFERING || w->len != w->head_len) return false;
+    // Framing is the writer's job
+    if (strcasecmp(name, "Content-Length") == 0 || strcasecmp(name, "Transfer-Encoding") == 0 ||
+        strcasecmp(name, "Connection") == 0) return false;
+    int len = snprintf(w->buf + w->head_len, HTTP_WRITER_BUFFER_SIZE - w->head_len, "%s: %s\r\n", name, value);
+    if (len < 0 || (size_t)len >= HTTP_WRITER_BUFFER_SIZE / 2 - w->head_len) return false;
+    if (strcasecmp(name, "Content-Type") == 0) w->has_type = true;
+    if (strcasecmp(name, "Cache-Control") == 0) w->has_cache = true;
+    w->head_len += len;
+    w->len = w->head_len;
+    return true;
+}
+
+static bool http_writer_open(http_writer_t* w){
+    return w->state != HTTP_WRITER_IDLE && !w->ending;
+}
+
+size_t http_write(http_writer_t* w, const void* data, size_t len){
+    size_t done = 0;
+    while (done < len && http_writer_open(w)) {
+        if (w->len == HTTP_WRITER_BUFFER_SIZE && !http_writer_flush(w)) break;
+        size_t n = HTTP_WRITER_BUFFER_SIZE - w->len;
+        if (n > len - done) n = len - done;
+        memcpy(w->buf + w->len, (const char*)data + done, n);
+        w->len += n;
+        done += n;
+    }
+    if (!w->dispatching && http_writer_open(w)) tcp_output(w->pcb);
+    return done;
+}
+
+bool http_printf(http_writer_t* w, const char* format, ...){
+    if (!http_writer_open(w)) return false;
+    va_list args;
+    va_start(args, format);
+    size_t room = HTTP_WRITER_BUFFER_SIZE - w->len;
+    int len = vsnprintf(w->buf + w->len, room, format, args);
+    va_end(args);
+    if (len < 0) return false;
+    if ((size_t)len < room) {
+        w->len += len;
+        return true;
+    }
+
+    // Too long for what is left of the staging buffer: format it aside
+    if ((size_t)len >= sizeof(http_response)) return false;
+    va_start(args, format);
+    vsnprintf(http_response, sizeof(http_response), format, args);
+    va_end(args);
+    return http_write(w, http_response, len) == (size_t)len;
+}
+
+bool http_write_static(http_writer_t* w, const void* data, size_t len){
+    if (!http_writer_open(w) || len > 0xFFFF) return false;
+    bool ok = http_writer_flush(w) && http_writer_send_body(w, data, len, 0);
+    if (!w->dispatching && http_writer_open(w)) tcp_output(w->pcb);
+    return ok;
+}
+
+size_t http_writer_space(http_writer_t* w){
+    if (!http_writer_open(w)) return 0;
+    size_t space = HTTP_WRITER_BUFFER_SIZE - w->len;
+    size_t sndbuf = tcp_sndbuf(w->pcb);
+    if (sndbuf > w->len + 16) space += sndbuf - w->len - 16;
+    return space;
+}
+
+void http_writer_on_drain(http_writer_t* w, http_writer_drain_t drain, void* arg){
+    w->drain = drain;
+    w->drain_arg = arg;
+}
+
+void http_end(http_writer_t* w){
+    if (!http_writer_open(w)) return;
+    w->ending = true;
+    if (!http_writer_finish(w)) return;   // completed from tcp_sent
+
+    // Called from the application, not from one of our callbacks: move on
+    // to whatever the connection does next
+    if (!w->dispatching) http_response_done(w->pcb, w->conn);
+}
+
+http_writer_ref_t http_writer_ref(http_writer_t* w){
+    return (http_writer_ref_t){w, w ? w->generation : 0};
+}
+
+// Writers live in the connection pool, so a stale one is still safe to read
+http_writer_t* http_writer_get(http_writer_ref_t ref){
+    if (!ref.writer || ref.generation == 0 || ref.writer->generation != ref.generation) return NULL;
+    return ref.writer;
+}
+
+// Runs a writer handler. Returns whether the connection stays open; the
+// response may still be in progress (http_response_active).
+static bool http_writer_run(struct tcp_pcb *tpcb, http_conn_t* conn, route_writer_handler_t handler,
+                            const http_route_params_t* params, char* query_parameters, bool keep_alive){
+    http_writer_t* w = &conn->writer;
+    char* buf = ws_pool_alloc(&http_writer_pool);
+    if (!buf) return http_send_status(tpcb, "503 Service Unavailable", keep_alive);
+
+    if (++http_writer_generation == 0) http_writer_generation = 1;
+    *w = (http_writer_t){
+        .conn = conn,
+        .pcb = tpcb,
+        .generation = http_writer_generation,
+        .buf = buf,
+        .status = "200 OK",
+        .state = HTTP_WRITER_BUFFERING,
+        .chunked_ok = conn->parser.version == 11,
+        .keep_alive = keep_alive,
+        .dispatching = true
+    };
+    handler(w, params, query_parameters);
+    w->dispatching = false;
+    if (w->state == HTTP_WRITER_RAW) keep_alive = false;
+    return w->keep_alive && keep_alive;
+}
+
+// Called from tcp_sent: finishes an ended response or asks for more
+static void http_writer_drain(http_writer_t* w){
+    w->dispatching = true;
+    if (w->ending) {
+        http_writer_finish(w);
+    } else if (http_writer_flush(w) && w->drain) {
+        w->drain(w, w->drain_arg);
+    }
+    w->dispatching = false;
+}
+
+// Whether an If-None-Match list ("a", W/"b" or *) names `etag`
+static bool http_etag_matches(const char* list, const char* etag){
+    if (!list) return false;
+    size_t etag_len = strlen(etag);
+
+    while (*list) {
+        while (*list == ' ' || *list == '\t' || *list == ',') list++;
+        if (*list == '*') return true;
+        if (strncmp(list, "W/", 2) == 0) list += 2;
+        size_t len = strcspn(list, ", \t");
+        if (len == etag_len && strncmp(list, etag, len) == 0) return true;
+        list += len;
+    }
+    return false;
+}
+
+static const char http_keep_alive_end[] = LB("Connection: keep-alive") LB("");
+static const char http_close_end[] = LB("Connection: close") LB("");
+
+// Sends a constant response. Nothing is formatted: the prebuilt header and the
+// body are written as they are (lwIP copies them, see lwipopts.h). Bodies are
+// streamed from tcp_sent a window at a time; generated bodies are produced
+// chunk by chunk as the send buffer drains.
+static bool http_send_static(struct tcp_pcb *tpcb, http_conn_t* conn, const http_static_response_t* resp, bool keep_alive){
+    // HTTP/1.0 knows no chunks: a body of unknown length ends with the connection
+    bool chunked = resp->body_len == HTTP_BODY_CHUNKED && conn->parser.version == 11;
+    if (resp->body_len == HTTP_BODY_CHUNKED && !chunked) keep_alive = false;
+
+    const char* end = keep_alive ? http_keep_alive_end : http_close_end;
+    size_t end_len = keep_alive ? sizeof(http_keep_alive_end) - 1 : sizeof(http_close_end) - 1;
+
+    bool gzip = resp->gzip_body &&
+                (!resp->body || http_parser_header_has_token(&conn->parser, HTTP_HDR_ACCEPT_ENCODING, "gzip"));
+    const char* body = gzip ? (const char*)resp->gzip_body : resp->body;
+    size_t body_len = gzip ? resp->gzip_len : resp->body_len;
+
+    // The browser's copy is current: answer with the validator only
+    const char* etag = gzip ? resp->gzip_etag : resp->etag;
+    if (etag && http_etag_matches(http_parser_header(&conn->parser, HTTP_HDR_IF_NONE_MATCH), etag)) {
+        char resp304[160];
+        int len = snprintf(resp304, sizeof(resp304),
+            LB("HTTP/1.1 304 Not Modified")
+            LB("ETag: %s")
+            LB("Cache-Control: no-cache")
+            "%s",
+            etag, resp->gzip_body ? LB("Vary: Accept-Encoding") : "");
+        return tcp_write(tpcb, resp304, len, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE) == ERR_OK &&
+               tcp_write(tpcb, end, end_len, 0) == ERR_OK && keep_alive;
+    }
+
+    bool framed = resp->body_len != HTTP_BODY_CHUNKED || chunked;
+    if (tcp_write(tpcb, resp->header, resp->header_len, TCP_WRITE_FLAG_MORE) != ERR_OK ||
+        (framed && tcp_write(tpcb, gzip ? resp->gzip_length : resp->length,
+                             gzip ? resp->gzip_length_len : resp->length_len, TCP_WRITE_FLAG_MORE) != ERR_OK) ||
+        tcp_write(tpcb, end, end_len, body_len ? TCP_WRITE_FLAG_MORE : 0) != ERR_OK) {
+        return false;
+    }
+
+    conn->stream = (http_stream_t){
+        .data = body,
+        .generator = resp->generator,
+        .generator_arg = resp->generator_arg,
+        .len = body_len,
+        .chunked = chunked
+    };
+    return http_stream_pump(tpcb, conn) && keep_alive;
+}
+
+// Hands the connection over to the handler of its Upgrade schema. Handlers get
+// a minimal request rebuilt from the parsed fields instead of the raw bytes.
+static err_t http_upgrade(struct tcp_pcb *tpcb, http_conn_t* conn, struct pbuf *p, new_schema_handler_t handler){
+    http_parser_t* hp = &conn->parser;
+    const char* key = http_parser_header(hp, HTTP_HDR_SEC_WEBSOCKET_KEY);
+
+    int len = snprintf(payload_temp_buff, sizeof(payload_temp_buff),
+        "%s %s HTTP/1.1\r\n"
+        "%s%s%s"
+        "\r\n",
+        http_parser_method(hp), http_parser_path(hp),
+        key ? "Sec-WebSocket-Key: " : "", key ? key : "", key ? "\r\n" : "");
+    if (len < 0 || (size_t)len >= sizeof(payload_temp_buff)) {
+        http_send_status(tpcb, "431 Request Header Fields Too Large", false);
+        return http_close_lingering(tpcb, conn, p, p->tot_len);
+    }
+
+    // From here on the schema owns the connection (and frees p)
+    http_conn_release(tpcb, conn);
+    err_t err = handler(payload_temp_buff, tpcb, p);
+    if (err == ERR_OK || err == ERR_ABRT) return err;
+
+    http_send_status(tpcb, "400 Bad Request", false);
+    return http_close(tpcb, NULL);
+}
+
+// Whether the client allows the connection to persist after this request
+static bool http_wants_keep_alive(http_conn_t* conn){
+    http_parser_t* hp = &conn->parser;
+
+    if (conn->requests >= HTTP_MAX_REQUESTS_PER_CONNECTION) return false;
+    if (ws_governor_level() != WS_GOV_NORMAL) return false;
+
+    if (hp->version == 10) return http_parser_header_has_token(hp, HTTP_HDR_CONNECTION, "keep-alive");
+    return !http_parser_header_has_token(hp, HTTP_HDR_CONNECTION, "close");
+}
+
+// Whether the request carries a body (anything but "Content-Length: 0")
+static bool http_has_body(http_parser_t* hp){
+    size_t length;
+    if (http_parser_header(hp, HTTP_HDR_TRANSFER_ENCODING)) return true;
+    const char* value = http_parser_header(hp, HTTP_HDR_CONTENT_LENGTH);
+    return value && !(http_parse_content_length(value, &length) && length == 0);
+}
+
+// Starts reading the body of a POST/PUT for `handler`. The body itself is read
+// by http_process as it arrives. Returns false if it is refused up front.
+static bool http_body_begin(struct tcp_pcb *tpcb, http_conn_t* conn, const http_body_handler_t* handler,
+                            const http_route_params_t* params, bool keep_alive){
+    http_parser_t* hp = &conn->parser;
+    const char* encoding = http_parser_header(hp, HTTP_HDR_TRANSFER_ENCODING);
+    const char* length_value = http_parser_header(hp, HTTP_HDR_CONTENT_LENGTH);
+    size_t length = 0;
+
+    // Only "chunked" is understood; the parser refused requests that also
+    // carry a Content-Length
+    bool chunked = encoding != NULL;
+    if (chunked && strcasecmp(encoding, "chunked") != 0) {
+        return http_send_status(tpcb, "501 Not Implemented", false);
+    }
+    if (!chunked && length_value && !http_parse_content_length(length_value, &length)) {
+        return http_send_status(tpcb, "400 Bad Request", false);
+    }
+
+    void* ctx = NULL;
+    if (!handler->on_begin(tpcb, http_parser_method(hp), params, http_parser_query(hp),
+                           chunked ? HTTP_BODY_CHUNKED : length, &ctx)) {
+        return http_send_status(tpcb, "413 Content Too Large", false);
+    }
+
+    // The client waits for this before sending the body
+    if ((chunked || length) && http_parser_header_has_token(hp, HTTP_HDR_EXPECT, "100-continue")) {
+        static const char http_continue[] = LB("HTTP/1.1 100 Continue") LB("");
+        tcp_write(tpcb, http_continue, sizeof(http_continue) - 1, 0);
+        tcp_output(tpcb);
+    }
+
+    conn->body = (http_body_t){.handler = handler, .ctx = ctx, .keep_alive = keep_alive};
+    http_body_parser_init(&conn->body.parser, chunked, length);
+    return true;
+}
+
+enum {
+    HTTP_BODY_READ_MORE,      // everything received so far was consumed
+    HTTP_BODY_READ_PAUSED,    // the handler stopped taking bytes
+    HTTP_BODY_READ_DONE,
+    HTTP_BODY_READ_FAILED
+};
+
+// Hands the body bytes in `p` from `offset` on to the handler, in place. Only
+// the bytes consumed (framing included) are acknowledged with tcp_recved, so
+// a handler that pauses closes the client's window instead of filling RAM.
+static int http_body_read(struct tcp_pcb *tpcb, http_conn_t* conn, struct pbuf* p, uint16_t* offset){
+    http_body_t* body = &conn->body;
+
+    while (true) {
+        const char* data = NULL;
+        size_t avail = 0;
+        if (*offset < p->tot_len) {
+            u16_t at;
+            struct pbuf* q = pbuf_skip(p, *offset, &at);
+            data = (const char*)q->payload + at;
+            avail = q->len - at;
+        }
+
+        size_t framing, len;
+        HTTP_BODY_RESULT result = http_body_parser_next(&body->parser, data, avail, &framing, &len);
+        if (framing) {
+            tcp_recved(tpcb, framing);
+            *offset += framing;
+        }
+        if (result == HTTP_BODY_DONE) return HTTP_BODY_READ_DONE;
+        if (result == HTTP_BODY_INVALID) return HTTP_BODY_READ_FAILED;
+        if (result == HTTP_BODY_NEED_MORE) {
+            if (*offset < p->tot_len) continue;
+            return HTTP_BODY_READ_MORE;
         }
-    } else{
-        if (sscanf(payload_temp_buff, "%7s %255s", method, path) != 2) {
-            goto send_404;
+
+        int taken = body->handler->on_data(body->ctx, (const uint8_t*)data + framing, len);
+        if (taken < 0) return HTTP_BODY_READ_FAILED;
+        if ((size_t)taken > len) taken = len;
+        http_body_parser_consume(&body->parser, taken);
+        if (taken) {
+            tcp_recved(tpcb, taken);
+            *offset += taken;
         }
+        if ((size_t)taken < len) return HTTP_BODY_READ_PAUSED;
     }
-    
-    if (dns_captive_site_response(tpcb, p, payload_temp_buff)) {
-        pbuf_free(p);
-        tcp_close(tpcb);
-        return ERR_OK;
+}
+
+// Body complete: the handler writes the response
+static bool http_body_end(struct tcp_pcb *tpcb, http_conn_t* conn){
+    http_body_t body = conn->body;
+    conn->body.handler = NULL;
+    body.handler->on_end(body.ctx, http_response, sizeof(http_response));
+    return http_send_response(tpcb, http_response, body.keep_alive);
+}
+
+// Captive-portal probes: what each OS fetches right after joining a network,
+// and the answer it expects when the internet is reachable. The answers are
+// complete responses kept in flash, written as they are with nothing formatted.
+#define HTTP_PROBE_RESPONSE(status, type, length, body) \
+        LB("HTTP/1.1 " status) \
+        LB("Content-Type: " type) \
+        LB("Cache-Control: no-cache, no-store, must-revalidate") \
+        LB("Connection: close") \
+        LB("Content-Length: " #length) \
+        LB("") \
+        body
+
+static const char http_probe_no_content[] = HTTP_PROBE_RESPONSE("204 No Content", "text/plain", 0, "");
+static const char http_probe_apple[] = HTTP_PROBE_RESPONSE("200 OK", "text/html", 68,
+        "<HTML><HEAD><TITLE>Success</TITLE></HEAD><BODY>Success</BODY></HTML>");
+static const char http_probe_windows[] = HTTP_PROBE_RESPONSE("200 OK", "text/plain", 22, "Microsoft Connect Test");
+static const char http_probe_windows_legacy[] = HTTP_PROBE_RESPONSE("200 OK", "text/plain", 14, "Microsoft NCSI");
+static const char http_probe_firefox[] = HTTP_PROBE_RESPONSE("200 OK", "text/plain", 8, "success\n");
+static const char http_probe_firefox_canonical[] = HTTP_PROBE_RESPONSE("200 OK", "text/html", 90,
+        "<meta http-equiv=\"refresh\" content=\"0;url=https://support.mozilla.org/kb/captive-portal\"/>");
+
+#define HTTP_PROBE(path, online) {path, sizeof(path) - 1, online, sizeof(online) - 1}
+
+typedef struct {
+    const char* path;
+    uint8_t path_len;
+    const char* online;     // answer of HTTP_CAPTIVE_ONLINE
+    uint16_t online_len;
+} http_captive_probe_t;
+
+static const http_captive_probe_t http_captive_probes[] = {
+    HTTP_PROBE("/generate_204", http_probe_no_content),                 // Android, ChromeOS
+    HTTP_PROBE("/gen_204", http_probe_no_content),                      // Android
+    HTTP_PROBE("/hotspot-detect.html", http_probe_apple),               // iOS, macOS
+    HTTP_PROBE("/library/test/success.html", http_probe_apple),         // iOS, macOS (older)
+    HTTP_PROBE("/connecttest.txt", http_probe_windows),                 // Windows 10+
+    HTTP_PROBE("/ncsi.txt", http_probe_windows_legacy),                 // Windows 7/8
+    HTTP_PROBE("/success.txt", http_probe_firefox),                     // Firefox
+    HTTP_PROBE("/canonical.html", http_probe_firefox_canonical),        // Firefox
+    {"/redirect", 9, NULL, 0}                                           // Windows opens the portal here
+};
+
+static HTTP_CAPTIVE_POLICY http_captive_policy = HTTP_CAPTIVE_DEFAULT_POLICY;
+// The redirect to the portal, built on the first probe (the site name is
+// set when the access point comes up) and then reused as it is
+static char http_captive_redirect[sizeof(DNS_CAPTIVE_RESPONSE_HEADER) + sizeof(dnss_captive_site)];
+static uint16_t http_captive_redirect_len;
+
+void http_set_captive_policy(HTTP_CAPTIVE_POLICY policy){
+    http_captive_policy = policy;
+}
+
+// Answers a probe and returns true, or returns false if `path` is not one.
+// Exact matches only: other requests cost a length comparison per probe.
+static bool http_send_captive_probe(struct tcp_pcb *tpcb, const char* path){
+    size_t path_len = strlen(path);
+    const http_captive_probe_t* probe = NULL;
+    for (size_t ii = 0; ii < count_of(http_captive_probes); ii++) {
+        if (http_captive_probes[ii].path_len == path_len && memcmp(http_captive_probes[ii].path, path, path_len) == 0) {
+            probe = &http_captive_probes[ii];
+            break;
+        }
+    }
+    if (!probe) return false;
+
+    if (http_captive_policy == HTTP_CAPTIVE_ONLINE && probe->online) {
+        tcp_write(tpcb, probe->online, probe->online_len, 0);
+        return true;
     }
+    if (http_captive_redirect_len == 0) {
+        http_captive_redirect_len = snprintf(http_captive_redirect, sizeof(http_captive_redirect),
+                                             DNS_CAPTIVE_RESPONSE_HEADER, dnss_captive_site);
+    }
+    tcp_write(tpcb, http_captive_redirect, http_captive_redirect_len, 0);
+    return true;
+}
+
+// Answers one complete request. Returns whether the connection stays open.
+static bool http_send_route(struct tcp_pcb *tpcb, http_conn_t* conn, const http_route_item_t* route,
+                            const http_route_params_t* params, char* query_parameters, bool keep_alive){
+    if (route->static_response) {
+        return http_send_static(tpcb, conn, route->static_response, keep_alive);
+    }
+    if (route->route_writer_handler) {
+        return http_writer_run(tpcb, conn, route->route_writer_handler, params, query_parameters, keep_alive);
+    }
+    if (route->route_param_handler) {
+        route->route_param_handler(params, query_parameters, http_response, sizeof(http_response));
+    } else {
+        route->route_response_handler(query_parameters, http_response, sizeof(http_response));
+    }
+    return http_send_response(tpcb, http_response, keep_alive);
+}
+
+static bool http_handle_request(struct tcp_pcb *tpcb, http_conn_t* conn){
+    http_parser_t* hp = &conn->parser;
+    char* method = http_parser_method(hp);
+    char* path = http_parser_path(hp);
+    char* query_parameters = http_parser_query(hp);
+
+    conn->requests++;
+    bool keep_alive = http_wants_keep_alive(conn);
+
+    if ((strcmp(method, "POST") == 0 || strcmp(method, "PUT") == 0) && http_body_router.count) {
+        http_route_params_t params = {0};
+        const http_body_handler_t* handler = http_router_match(&http_body_router, path, strlen(path), &params);
+        if (handler) {
+            return http_body_begin(tpcb, conn, handler, &params, keep_alive);
+        }
+    }
+
+    // A body nobody reads leaves the connection unusable
+    if (http_has_body(hp)) keep_alive = false;
 
     if (strcmp(method, "GET") == 0) {
-        
+        http_route_params_t params = {0};
 
             #ifdef LINEAR_DYNAMIC_ARRAY_SEARCH
 
                 for (size_t i = 0; i < http_routes->count; ++i) {
                     if (strcmp(path, http_routes->items[i].route_path) == 0) {
-                        http_routes->items[i]
-                            .route_response_handler(http_response, sizeof(http_response));
-                        tcp_write(tpcb, http_response, strlen(http_response),
-                                TCP_WRITE_FLAG_COPY);
-                        tcp_output(tpcb);
-                        pbuf_free(p);
-                        tcp_close(tpcb);
-                        return ERR_OK;
+                        const http_route_t* r = &http_routes->items[i];
+                        http_route_item_t found = (http_route_item_t){r->route_path_len,r->route_response_handler,r->static_response,r->route_param_handler,r->route_writer_handler};
+                        return http_send_route(tpcb, conn, &found, &params, query_parameters, keep_alive);
                     }
                 }
             
@@ -144,37 +1111,281 @@ static err_t http_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_
             #ifdef HASHMAP_SEARCH
 
                 http_route_item_t found = shget(http_routes_hmap,path);
-                if (found.route_response_handler){
-                    found.route_response_handler(query_parameters,http_response, sizeof(http_response));
-                    tcp_write(tpcb, http_response, strlen(http_response),TCP_WRITE_FLAG_COPY);
-                    tcp_output(tpcb);
-                    pbuf_free(p);
-                    tcp_close(tpcb);
-                    return ERR_OK;
+                if (found.static_response || found.route_response_handler || found.route_param_handler || found.route_writer_handler){
+                    return http_send_route(tpcb, conn, &found, &params, query_parameters, keep_alive);
+                }
+
+            #endif
+
+            #ifdef PERFECT_HASH_SEARCH
+
+                const http_static_response_t* static_response = http_route_table_find(path);
+                if (static_response){
+                    return http_send_static(tpcb, conn, static_response, keep_alive);
                 }
 
             #endif
 
+        // Patterns (and every route with RADIX_TREE_SEARCH, every route
+        // outside the table with PERFECT_HASH_SEARCH): the captures
+        // point into the parser buffer, valid until the response is built
+        const http_route_item_t* matched = http_router_match(&http_router, path, strlen(path), &params);
+        if (matched) {
+            return http_send_route(tpcb, conn, matched, &params, query_parameters, keep_alive);
+        }
+
+        // Connectivity checks of the devices joining the access point, after
+        // the routes so that page loads never look at them
+        if (http_send_captive_probe(tpcb, path)) return false;
     }
 
-send_404:
-    {
-        const char *resp404 =
-            "HTTP/1.1 404 Not Found\r\n"
-            "Connection: close\r\n"
-            "Content-Length: 0\r\n"
-            "\r\n";
-        tcp_write(tpcb, resp404, strlen(resp404), TCP_WRITE_FLAG_COPY);
-        tcp_output(tpcb);
+    return http_send_status(tpcb, "404 Not Found", keep_alive);
+}
+
+// Parses and answers the requests in `p` from `offset` on, in order. A
+// response that is still streaming holds back the requests behind it.
+static err_t http_process(struct tcp_pcb *tpcb, http_conn_t* conn, struct pbuf *p, uint16_t offset){
+    http_parser_t* hp = &conn->parser;
+
+    while (true) {
+        if (conn->body.handler) {
+            int status = http_body_read(tpcb, conn, p, &offset);
+            if (status == HTTP_BODY_READ_MORE) break;
+            if (status == HTTP_BODY_READ_PAUSED) {
+                conn->pending = p;
+                conn->pending_offset = offset;
+                tcp_output(tpcb);
+                return ERR_OK;
+            }
+            if (status == HTTP_BODY_READ_FAILED) {
+                http_body_abort(conn);
+                http_send_status(tpcb, "400 Bad Request", false);
+                return http_close_lingering(tpcb, conn, p, offset);
+            }
+            if (!http_body_end(tpcb, conn)) {
+                return http_close_lingering(tpcb, conn, p, offset);
+            }
+            continue;
+        }
+        if (offset >= p->tot_len) break;
+
+        uint16_t used;
+        HTTP_PARSE_RESULT result = http_parser_feed_pbuf(hp, p, offset, &used);
+        offset += used;
+        tcp_recved(tpcb, used);
+
+        if (result == HTTP_PARSE_INCOMPLETE) {
+            if (used) conn->reading_head = true;
+            break;
+        }
+        conn->reading_head = false;
+        conn->head_polls = 0;
+        if (result != HTTP_PARSE_COMPLETE) {
+            http_send_status(tpcb, result == HTTP_PARSE_URI_TOO_LONG ? "414 URI Too Long" :
+                                   result == HTTP_PARSE_HEADERS_TOO_LARGE ? "431 Request Header Fields Too Large" :
+                                   "400 Bad Request", false);
+            return http_close_lingering(tpcb, conn, p, offset);
+        }
+
+        const char* upgrade = http_parser_header(hp, HTTP_HDR_UPGRADE);
+        if (upgrade) {
+            for (size_t i = 0; i < new_schemas_routes->count; ++i){
+                if (strcasecmp(upgrade, new_schemas_routes->items[i].new_schema) == 0){
+                    // Whatever follows the head now belongs to the schema
+                    if (offset < p->tot_len) tcp_recved(tpcb, p->tot_len - offset);
+                    return http_upgrade(tpcb, conn, p, new_schemas_routes->items[i].new_schema_handler);
+                }
+            }
+        }
+
+        bool keep_alive = http_handle_request(tpcb, conn);
+        http_parser_reset(hp);
+        if (conn->body.handler) continue;
+
+        if (http_response_active(conn)) {
+            conn->close_after = !keep_alive;
+            if (keep_alive && offset < p->tot_len) {
+                conn->pending = p;
+                conn->pending_offset = offset;
+                tcp_output(tpcb);
+                return ERR_OK;
+            }
+            break;
+        }
+        if (!keep_alive) {
+            return http_close_lingering(tpcb, conn, p, offset);
+        }
+    }
+
+    // Anything left belongs to requests behind one that closes the connection
+    http_discard(tpcb, p, offset);
+    tcp_output(tpcb);
+    return ERR_OK;
+}
+
+// Offers a paused body to its handler again
+static err_t http_body_continue(struct tcp_pcb *tpcb, http_conn_t* conn){
+    if (!conn->body.handler || !conn->pending || http_response_active(conn)) return ERR_OK;
+    struct pbuf* p = conn->pending;
+    conn->pending = NULL;
+    return http_process(tpcb, conn, p, conn->pending_offset);
+}
+
+void http_body_resume(struct tcp_pcb* tpcb){
+    http_conn_t* conn = tpcb->callback_arg;
+    if (conn) http_body_continue(tpcb, conn);
+}
+
+static err_t http_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
+    http_conn_t* conn = arg;
+
+    if (p == NULL) {
+        if (tpcb->state == CLOSED || tpcb->state == TIME_WAIT) {
+            if (conn) http_conn_release(tpcb, conn);
+            return ERR_OK;
+        }
+        // Half-close: nothing more will be read, but a response in flight is
+        // finished before closing (http_response_done)
+        if (conn && http_response_active(conn)) {
+            conn->close_after = true;
+            return ERR_OK;
+        }
+        return http_close(tpcb, conn);
+    }
+
+    // Data arriving after the response, while the connection closes
+    if (!conn) {
+        tcp_recved(tpcb, p->tot_len);
         pbuf_free(p);
-        tcp_close(tpcb);
+        return ERR_OK;
+    }
+
+    // Busy with a response or a paused body: lwIP keeps the data and offers it
+    // again later, and the unacknowledged window slows the client down meanwhile
+    if (http_response_active(conn) || conn->pending) return ERR_MEM;
+
+    conn->idle_polls = 0;
+
+    // A request head may span several pbufs and several callbacks, and one
+    // segment may carry several pipelined requests: they are answered in order.
+    // The window is reopened as http_process consumes the bytes.
+    return http_process(tpcb, conn, p, 0);
+}
+
+// A response finished after its request was handled: close, or go on with
+// the requests queued behind it
+static err_t http_response_done(struct tcp_pcb *tpcb, http_conn_t* conn){
+    if (conn->close_after) {
+        return http_close_lingering(tpcb, conn, NULL, 0);
+    }
+    if (conn->pending) {
+        struct pbuf* p = conn->pending;
+        conn->pending = NULL;
+        return http_process(tpcb, conn, p, conn->pending_offset);
+    }
+    tcp_output(tpcb);
+    return ERR_OK;
+}
+
+// Continues a streamed body or a writer and, once the response is complete,
+// the requests queued behind it
+static err_t http_sent(void *arg, struct tcp_pcb *tpcb, u16_t len){
+    http_conn_t* conn = arg;
+    if (!conn) return ERR_OK;
+    conn->idle_polls = 0;
+    if (!http_response_active(conn)) return ERR_OK;
+
+    if (conn->writer.state != HTTP_WRITER_IDLE) {
+        http_writer_drain(&conn->writer);
+    } else if (!http_stream_pump(tpcb, conn)) {
+        return http_close(tpcb, conn);
+    }
+    if (http_response_active(conn)) {
+        tcp_output(tpcb);
+        return ERR_OK;
+    }
+    return http_response_done(tpcb, conn);
+}
+
+// Closes keep-alive connections that stay silent for too long
+static err_t http_poll(void *arg, struct tcp_pcb *tpcb){
+    http_conn_t* conn = arg;
+    if (!conn) return ERR_OK;
+
+    // Waiting on our own handler, not on the client
+    if (conn->body.handler && conn->pending) {
+        conn->idle_polls = 0;
+        return http_body_continue(tpcb, conn);
     }
 
+    // A head trickling in byte by byte keeps the connection from going idle,
+    // so it has a deadline of its own
+    if (conn->reading_head && ++conn->head_polls >= HTTP_HEADER_TIMEOUT_S * 1000 / (HTTP_POLL_INTERVAL * 500)) {
+        if (conn->parser.len > 0) {
+            http_send_status(tpcb, "408 Request Timeout", false);
+            return http_close_lingering(tpcb, conn, NULL, 0);
+        }
+        return http_close(tpcb, conn);
+    }
+    if (++conn->idle_polls >= HTTP_KEEPALIVE_TIMEOUT_S * 1000 / (HTTP_POLL_INTERVAL * 500)) {
+        return http_close(tpcb, conn);
+    }
+    // A response stalled on memory with nothing in flight gets no tcp_sent
+    if (http_response_active(conn) && tcp_sndbuf(tpcb) == TCP_SND_BUF) {
+        return http_sent(conn, tpcb, 0);
+    }
     return ERR_OK;
 }
 
+// Closes the connection that has waited longest between requests, to make
+// room for a new one. Connections in the middle of a request are kept.
+static bool http_evict_idle(void){
+    http_conn_t* victim = NULL;
+    for (size_t ii = 0; ii < HTTP_MAX_CONNECTIONS; ii++) {
+        http_conn_t* conn = http_conns[ii];
+        if (!conn || conn->parser.len > 0 || conn->pending || conn->body.handler || http_response_active(conn)) continue;
+        if (!victim || conn->idle_polls > victim->idle_polls) victim = conn;
+    }
+    if (!victim) return false;
+    http_close(victim->pcb, victim);
+    return true;
+}
+
 static err_t connection_callback(void *arg, struct tcp_pcb *newpcb, err_t err) {
+    // A slot first (evicting an idle connection if needed, which also frees
+    // memory), then the governor, which only judges the lwIP heap and pbufs
+    http_conn_t* conn = ws_pool_alloc(&http_conn_pool);
+    if (!conn && http_evict_idle()) conn = ws_pool_alloc(&http_conn_pool);
+    if (!conn) {
+        return ws_governor_reject(newpcb);
+    }
+    if (!ws_governor_admit()) {
+        ws_pool_free(&http_conn_pool, conn);
+        return ws_governor_reject(newpcb);
+    }
+    for (size_t ii = 0; ii < HTTP_MAX_CONNECTIONS; ii++) {
+        if (!http_conns[ii]) {
+            http_conns[ii] = conn;
+            break;
+        }
+    }
+    conn->pcb = newpcb;
+    conn->requests = 0;
+    conn->idle_polls = 0;
+    conn->head_polls = 0;
+    conn->reading_head = true;
+    conn->close_after = false;
+    conn->stream = (http_stream_t){0};
+    conn->pending = NULL;
+    conn->body = (http_body_t){0};
+    conn->writer = (http_writer_t){0};
+    http_parser_reset(&conn->parser);
+
+    tcp_arg(newpcb, conn);
+    tcp_err(newpcb, http_err_callback);
     tcp_recv(newpcb, http_callback);
+    tcp_poll(newpcb, http_poll, HTTP_POLL_INTERVAL);
+    tcp_sent(newpcb, http_sent);
     return ERR_OK;
 }
 
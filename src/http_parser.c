@@ -0,0 +1,341 @@
+#include <string.h>
+#include <strings.h>
+#include "http_parser.h"
+
+enum {
+    HTTP_STATE_METHOD,
+    HTTP_STATE_TARGET,
+    HTTP_STATE_VERSION,
+    HTTP_STATE_HEADER_NAME,
+    HTTP_STATE_HEADER_VALUE,
+    HTTP_STATE_DONE
+};
+
+static const char* const http_header_names[HTTP_HDR_COUNT] = {
+    [HTTP_HDR_HOST]              = "host",
+    [HTTP_HDR_CONNECTION]        = "connection",
+    [HTTP_HDR_UPGRADE]           = "upgrade",
+    [HTTP_HDR_SEC_WEBSOCKET_KEY] = "sec-websocket-key",
+    [HTTP_HDR_CONTENT_LENGTH]    = "content-length",
+    [HTTP_HDR_TRANSFER_ENCODING] = "transfer-encoding",
+    [HTTP_HDR_ACCEPT_ENCODING]   = "accept-encoding",
+    [HTTP_HDR_IF_NONE_MATCH]     = "if-none-match",
+    [HTTP_HDR_EXPECT]            = "expect",
+};
+
+void http_parser_reset(http_parser_t* hp){
+    memset(hp, 0, offsetof(http_parser_t, name));
+    hp->result = HTTP_PARSE_INCOMPLETE;
+}
+
+static bool http_parser_put(http_parser_t* hp, char c){
+    if (hp->len >= sizeof(hp->buf)) return false;
+    hp->buf[hp->len++] = c;
+    return true;
+}
+
+static int http_header_lookup(const char* name, size_t len){
+    if (len > HTTP_PARSER_NAME_MAX) return -1;
+    for (int i = 0; i < HTTP_HDR_COUNT; i++) {
+        if (strlen(http_header_names[i]) == len && memcmp(http_header_names[i], name, len) == 0) return i;
+    }
+    return -1;
+}
+
+static bool http_is_tchar(char c){
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           (c && strchr("!#$%&'*+-.^_`|~", c));
+}
+
+static HTTP_PARSE_RESULT http_parser_step(http_parser_t* hp, char c){
+    switch (hp->state) {
+    case HTTP_STATE_METHOD:
+        if (c == '\r' || c == '\n') {
+            // Stray line breaks between pipelined requests are allowed
+            return hp->len == 0 ? HTTP_PARSE_INCOMPLETE : HTTP_PARSE_INVALID;
+        }
+        if (c == ' ') {
+            if (hp->len == 0) return HTTP_PARSE_INVALID;
+            http_parser_put(hp, '\0');
+            hp->target = hp->len;
+            hp->state = HTTP_STATE_TARGET;
+            return HTTP_PARSE_INCOMPLETE;
+        }
+        if (hp->len >= HTTP_METHOD_MAX - 1 || !http_is_tchar(c)) return HTTP_PARSE_INVALID;
+        http_parser_put(hp, c);
+        return HTTP_PARSE_INCOMPLETE;
+
+    case HTTP_STATE_TARGET:
+        if (c == ' ') {
+            if (hp->len == hp->target) return HTTP_PARSE_INVALID;
+            if (!http_parser_put(hp, '\0')) return HTTP_PARSE_URI_TOO_LONG;
+            if (!hp->query) {
+                hp->query = hp->len;
+                if (!http_parser_put(hp, '\0')) return HTTP_PARSE_URI_TOO_LONG;
+            }
+            hp->version_at = hp->len;
+            hp->state = HTTP_STATE_VERSION;
+            return HTTP_PARSE_INCOMPLETE;
+        }
+        if ((unsigned char)c <= ' ' || c == 0x7f) return HTTP_PARSE_INVALID;
+        if (c == '?' && !hp->query) {
+            if (!http_parser_put(hp, '\0')) return HTTP_PARSE_URI_TOO_LONG;
+            hp->query = hp->len;
+            return HTTP_PARSE_INCOMPLETE;
+        }
+        return http_parser_put(hp, c) ? HTTP_PARSE_INCOMPLETE : HTTP_PARSE_URI_TOO_LONG;
+
+    case HTTP_STATE_VERSION:
+        if (c == '\r') return HTTP_PARSE_INCOMPLETE;
+        if (c == '\n') {
+            const char* version = hp->buf + hp->version_at;
+            size_t len = hp->len - hp->version_at;
+            if (len == 8 && memcmp(version, "HTTP/1.1", 8) == 0) hp->version = 11;
+            else if (len == 8 && memcmp(version, "HTTP/1.0", 8) == 0) hp->version = 10;
+            else return HTTP_PARSE_INVALID;
+            // The version string is not kept
+            hp->len = hp->version_at;
+            hp->name_len = 0;
+            hp->state = HTTP_STATE_HEADER_NAME;
+            return HTTP_PARSE_INCOMPLETE;
+        }
+        if (hp->len - hp->version_at >= 8) return HTTP_PARSE_INVALID;
+        return http_parser_put(hp, c) ? HTTP_PARSE_INCOMPLETE : HTTP_PARSE_URI_TOO_LONG;
+
+    case HTTP_STATE_HEADER_NAME:
+        if (c == '\r') return HTTP_PARSE_INCOMPLETE;
+        if (c == '\n') {
+            if (hp->name_len != 0) return HTTP_PARSE_INVALID;
+            // Framed both ways, the body's end depends on who reads it (smuggling)
+            if (hp->headers[HTTP_HDR_CONTENT_LENGTH] && hp->headers[HTTP_HDR_TRANSFER_ENCODING]) {
+                return HTTP_PARSE_INVALID;
+            }
+            hp->state = HTTP_STATE_DONE;
+            return HTTP_PARSE_COMPLETE;
+        }
+        if (c == ':') {
+            if (hp->name_len == 0) return HTTP_PARSE_INVALID;
+            hp->header_id = http_header_lookup(hp->name, hp->name_len);
+            hp->value_start = hp->value_end = hp->len;
+            hp->state = HTTP_STATE_HEADER_VALUE;
+            return HTTP_PARSE_INCOMPLETE;
+        }
+        if (!http_is_tchar(c)) return HTTP_PARSE_INVALID;
+        if (hp->name_len < HTTP_PARSER_NAME_MAX) {
+            hp->name[hp->name_len] = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+        }
+        if (hp->name_len <= HTTP_PARSER_NAME_MAX) hp->name_len++;
+        return HTTP_PARSE_INCOMPLETE;
+
+    case HTTP_STATE_HEADER_VALUE:
+        if (c == '\n') {
+            if (hp->header_id >= 0) {
+                hp->len = hp->value_end;
+                if (!http_parser_put(hp, '\0')) return HTTP_PARSE_HEADERS_TOO_LARGE;
+                // A repeated header replaces the earlier value, except a
+                // Content-Length that disagrees with it
+                uint16_t earlier = hp->headers[hp->header_id];
+                if (hp->header_id == HTTP_HDR_CONTENT_LENGTH && earlier &&
+                    strcmp(hp->buf + earlier, hp->buf + hp->value_start) != 0) return HTTP_PARSE_INVALID;
+                hp->headers[hp->header_id] = hp->value_start;
+            }
+            hp->name_len = 0;
+            hp->state = HTTP_STATE_HEADER_NAME;
+            return HTTP_PARSE_INCOMPLETE;
+        }
+        if (c == '\r' || hp->header_id < 0) return HTTP_PARSE_INCOMPLETE;
+        if ((c == ' ' || c == '\t') && hp->len == hp->value_start) return HTTP_PARSE_INCOMPLETE;
+        if (!http_parser_put(hp, c)) return HTTP_PARSE_HEADERS_TOO_LARGE;
+        if (c != ' ' && c != '\t') hp->value_end = hp->len;
+        return HTTP_PARSE_INCOMPLETE;
+
+    default:
+        return HTTP_PARSE_COMPLETE;
+    }
+}
+
+HTTP_PARSE_RESULT http_parser_feed(http_parser_t* hp, const char* data, size_t len, size_t* consumed){
+    size_t i = 0;
+    while (i < len && hp->result == HTTP_PARSE_INCOMPLETE) {
+        hp->result = http_parser_step(hp, data[i++]);
+    }
+    if (consumed) *consumed = i;
+    return hp->result;
+}
+
+HTTP_PARSE_RESULT http_parser_feed_pbuf(http_parser_t* hp, struct pbuf* p, uint16_t offset, uint16_t* consumed){
+    uint16_t total = 0;
+    for (struct pbuf* q = p; q && hp->result == HTTP_PARSE_INCOMPLETE; q = q->next) {
+        if (offset >= q->len) {
+            offset -= q->len;
+            continue;
+        }
+        size_t used;
+        http_parser_feed(hp, (const char*)q->payload + offset, q->len - offset, &used);
+        total += used;
+        offset = 0;
+    }
+    if (consumed) *consumed = total;
+    return hp->result;
+}
+
+char* http_parser_method(http_parser_t* hp){
+    return hp->buf;
+}
+
+char* http_parser_path(http_parser_t* hp){
+    return hp->buf + hp->target;
+}
+
+char* http_parser_query(http_parser_t* hp){
+    return hp->buf + hp->query;
+}
+
+char* http_parser_header(http_parser_t* hp, HTTP_HEADER_ID id){
+    return hp->headers[id] ? hp->buf + hp->headers[id] : NULL;
+}
+
+bool http_parser_header_has_token(http_parser_t* hp, HTTP_HEADER_ID id, const char* token){
+    const char* value = http_parser_header(hp, id);
+    size_t token_len = strlen(token);
+
+    while (value && *value) {
+        while (*value == ' ' || *value == '\t' || *value == ',') value++;
+        size_t len = strcspn(value, ",;");
+        size_t trimmed = len;
+        while (trimmed && (value[trimmed - 1] == ' ' || value[trimmed - 1] == '\t')) trimmed--;
+        if (trimmed == token_len && strncasecmp(value, token, token_len) == 0) return true;
+        value += len;
+        if (*value == ';') value += strcspn(value, ",");
+    }
+    return false;
+}
+
+enum {
+    HTTP_BODY_STATE_DATA,           // body bytes (Content-Length, or inside a chunk)
+    HTTP_BODY_STATE_SIZE,           // chunk size in hex
+    HTTP_BODY_STATE_EXTENSION,      // ";name=value" after the size, ignored
+    HTTP_BODY_STATE_SIZE_LF,
+    HTTP_BODY_STATE_DATA_CR,        // CRLF closing a chunk
+    HTTP_BODY_STATE_DATA_LF,
+    HTTP_BODY_STATE_TRAILER,        // start of a trailer line (or of the final CRLF)
+    HTTP_BODY_STATE_TRAILER_LINE,
+    HTTP_BODY_STATE_TRAILER_LF,
+    HTTP_BODY_STATE_DONE
+};
+
+void http_body_parser_init(http_body_parser_t* bp, bool chunked, size_t content_length){
+    bp->digits = false;
+    bp->remaining = chunked ? 0 : content_length;
+    bp->state = chunked ? HTTP_BODY_STATE_SIZE :
+                content_length ? HTTP_BODY_STATE_DATA : HTTP_BODY_STATE_DONE;
+}
+
+static int http_hex_digit(char c){
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// End of a chunk-size line
+static void http_body_chunk_start(http_body_parser_t* bp){
+    bp->state = bp->remaining ? HTTP_BODY_STATE_DATA : HTTP_BODY_STATE_TRAILER;
+}
+
+static bool http_body_step(http_body_parser_t* bp, char c){
+    switch (bp->state) {
+    case HTTP_BODY_STATE_SIZE: {
+        int digit = http_hex_digit(c);
+        if (digit >= 0) {
+            if (bp->remaining > (SIZE_MAX >> 4)) return false;
+            bp->remaining = (bp->remaining << 4) | digit;
+            bp->digits = true;
+            return true;
+        }
+        if (!bp->digits) return false;
+        if (c == ';' || c == ' ' || c == '\t') bp->state = HTTP_BODY_STATE_EXTENSION;
+        else if (c == '\r') bp->state = HTTP_BODY_STATE_SIZE_LF;
+        else if (c == '\n') http_body_chunk_start(bp);
+        else return false;
+        return true;
+    }
+    case HTTP_BODY_STATE_EXTENSION:
+        if (c == '\n') http_body_chunk_start(bp);
+        return true;
+    case HTTP_BODY_STATE_SIZE_LF:
+        if (c != '\n') return false;
+        http_body_chunk_start(bp);
+        return true;
+    case HTTP_BODY_STATE_DATA_CR:
+        if (c == '\r') {
+            bp->state = HTTP_BODY_STATE_DATA_LF;
+            return true;
+        }
+        // A bare LF after the data is accepted too
+        /* fall through */
+    case HTTP_BODY_STATE_DATA_LF:
+        if (c != '\n') return false;
+        bp->state = HTTP_BODY_STATE_SIZE;
+        bp->digits = false;
+        bp->remaining = 0;
+        return true;
+    case HTTP_BODY_STATE_TRAILER:
+        if (c == '\r') bp->state = HTTP_BODY_STATE_TRAILER_LF;
+        else if (c == '\n') bp->state = HTTP_BODY_STATE_DONE;
+        else bp->state = HTTP_BODY_STATE_TRAILER_LINE;
+        return true;
+    case HTTP_BODY_STATE_TRAILER_LINE:
+        if (c == '\n') bp->state = HTTP_BODY_STATE_TRAILER;
+        return true;
+    case HTTP_BODY_STATE_TRAILER_LF:
+        if (c != '\n') return false;
+        bp->state = HTTP_BODY_STATE_DONE;
+        return true;
+    default:
+        return false;
+    }
+}
+
+HTTP_BODY_RESULT http_body_parser_next(http_body_parser_t* bp, const char* data, size_t len, size_t* framing, size_t* body_len){
+    size_t i = 0;
+    *body_len = 0;
+
+    while (bp->state != HTTP_BODY_STATE_DATA && bp->state != HTTP_BODY_STATE_DONE) {
+        if (i == len) {
+            *framing = i;
+            return HTTP_BODY_NEED_MORE;
+        }
+        if (!http_body_step(bp, data[i++])) {
+            *framing = i;
+            return HTTP_BODY_INVALID;
+        }
+    }
+    *framing = i;
+    if (bp->state == HTTP_BODY_STATE_DONE) return HTTP_BODY_DONE;
+    if (i == len) return HTTP_BODY_NEED_MORE;
+
+    *body_len = len - i < bp->remaining ? len - i : bp->remaining;
+    return HTTP_BODY_DATA;
+}
+
+void http_body_parser_consume(http_body_parser_t* bp, size_t n){
+    if (bp->state != HTTP_BODY_STATE_DATA) return;
+    bp->remaining -= n;
+    if (bp->remaining == 0) {
+        // A chunked body continues with the CRLF closing the chunk
+        bp->state = bp->digits ? HTTP_BODY_STATE_DATA_CR : HTTP_BODY_STATE_DONE;
+    }
+}
+
+bool http_parse_content_length(const char* value, size_t* length){
+    size_t n = 0;
+    if (!value || !*value) return false;
+    for (; *value; value++) {
+        if (*value < '0' || *value > '9') return false;
+        if (n > (SIZE_MAX - 9) / 10) return false;
+        n = n * 10 + (*value - '0');
+    }
+    *length = n;
+    return true;
+}
@@ -0,0 +1,104 @@
+#include <string.h>
+#include <limits.h>
+#include "http_query.h"
+
+static int http_query_hex(char c){
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Decodes the byte at `*pos` and moves past it. A '%' not followed by two hex
+// digits is kept as it is.
+static char http_query_decode_next(const char* src, size_t len, size_t* pos){
+    char c = src[(*pos)++];
+    if (c == '+') return ' ';
+    if (c == '%' && *pos + 2 <= len) {
+        int hi = http_query_hex(src[*pos]);
+        int lo = http_query_hex(src[*pos + 1]);
+        if (hi >= 0 && lo >= 0) {
+            *pos += 2;
+            return (char)(hi << 4 | lo);
+        }
+    }
+    return c;
+}
+
+static bool http_query_slice_equals(const char* src, size_t len, const char* text){
+    size_t pos = 0;
+    while (pos < len) {
+        if (*text == '\0' || http_query_decode_next(src, len, &pos) != *text) return false;
+        text++;
+    }
+    return *text == '\0';
+}
+
+void http_query_init(http_query_t* q, const char* query){
+    q->query = query ? query : "";
+    q->len = strlen(q->query);
+    q->pos = 0;
+}
+
+bool http_query_next(http_query_t* q, http_query_param_t* param){
+    while (q->pos < q->len) {
+        const char* start = q->query + q->pos;
+        const char* amp = memchr(start, '&', q->len - q->pos);
+        size_t pair_len = amp ? (size_t)(amp - start) : q->len - q->pos;
+        q->pos += pair_len + (amp ? 1 : 0);
+        if (pair_len == 0) continue;
+
+        const char* eq = memchr(start, '=', pair_len);
+        param->key = start;
+        param->key_len = eq ? (uint16_t)(eq - start) : (uint16_t)pair_len;
+        param->value = eq ? eq + 1 : start + pair_len;
+        param->value_len = eq ? (uint16_t)(pair_len - param->key_len - 1) : 0;
+        return true;
+    }
+    return false;
+}
+
+bool http_query_find(const char* query, const char* key, http_query_param_t* param){
+    http_query_t q;
+    http_query_init(&q, query);
+    while (http_query_next(&q, param)) {
+        if (http_query_slice_equals(param->key, param->key_len, key)) return true;
+    }
+    return false;
+}
+
+size_t http_query_decode(const char* src, size_t len, char* dst, size_t dst_size){
+    size_t pos = 0;
+    size_t out = 0;
+    if (dst_size == 0) return 0;
+    while (pos < len && out + 1 < dst_size) {
+        dst[out++] = http_query_decode_next(src, len, &pos);
+    }
+    dst[out] = '\0';
+    return out;
+}
+
+bool http_query_value_equals(const http_query_param_t* param, const char* text){
+    return http_query_slice_equals(param->value, param->value_len, text);
+}
+
+bool http_query_value_long(const http_query_param_t* param, long* out){
+    size_t pos = 0;
+    bool negative = false;
+    long value = 0;
+
+    if (pos < param->value_len && (param->value[pos] == '-' || param->value[pos] == '+')) {
+        negative = param->value[pos++] == '-';
+    }
+    if (pos == param->value_len) return false;
+
+    while (pos < param->value_len) {
+        char c = param->value[pos++];
+        if (c < '0' || c > '9') return false;
+        int digit = c - '0';
+        if (value > (LONG_MAX - digit) / 10) return false;
+        value = value * 10 + digit;
+    }
+    *out = negative ? -value : value;
+    return true;
+}
@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <string.h>
+#include "http_router.h"
+
+// ':' and '*' are only special at the start of a segment
+static bool http_router_special(const char* pattern, size_t i){
+    return (pattern[i] == ':' || pattern[i] == '*') && (i == 0 || pattern[i - 1] == '/');
+}
+
+bool http_router_is_pattern(const char* route_path){
+    for (size_t i = 0; route_path[i]; i++) {
+        if (http_router_special(route_path, i)) return true;
+    }
+    return false;
+}
+
+void http_router_init(http_router_t* router){
+    memset(router, 0, sizeof(*router));
+    router->count = 1;   // root
+}
+
+static uint8_t http_router_new_node(http_router_t* router, const char* prefix, size_t prefix_len){
+    if (router->count >= HTTP_ROUTER_MAX_NODES) {
+        printf("Erro: limite de %d nos de rotas atingido\n", HTTP_ROUTER_MAX_NODES);
+        return 0;
+    }
+    uint8_t index = router->count++;
+    router->nodes[index] = (http_router_node_t){.prefix = prefix, .prefix_len = prefix_len};
+    return index;
+}
+
+static size_t http_router_common(const char* a, size_t a_len, const char* b, size_t b_len){
+    size_t n = 0;
+    while (n < a_len && n < b_len && a[n] == b[n]) n++;
+    return n;
+}
+
+// Named child (":id", "*rest"): reused if the name matches, a clash otherwise
+static uint8_t http_router_named_child(http_router_t* router, uint8_t* link, const char* name, size_t name_len){
+    if (*link) {
+        http_router_node_t* child = &router->nodes[*link];
+        if (child->prefix_len != name_len || memcmp(child->prefix, name, name_len) != 0) return 0;
+        return *link;
+    }
+    *link = http_router_new_node(router, name, name_len);
+    return *link;
+}
+
+bool http_router_add(http_router_t* router, const char* pattern, const void* value){
+    uint8_t node = 0;
+    size_t pos = 0;
+    size_t len = strlen(pattern);
+    uint8_t params = 0;
+
+    while (pos < len) {
+        const char* rest = pattern + pos;
+
+        if (http_router_special(pattern, pos)) {
+            size_t name_len = 1;
+            while (pos + name_len < len && rest[name_len] != '/') name_len++;
+
+            if (rest[0] == '*') {
+                if (pos + name_len != len) goto invalid;   // must be last
+                const char* name = name_len > 1 ? rest + 1 : rest;
+                if (params >= HTTP_ROUTE_MAX_PARAMS) goto invalid;
+                node = http_router_named_child(router, &router->nodes[node].wildcard, name, name_len > 1 ? name_len - 1 : 1);
+            } else {
+                if (name_len == 1 || params >= HTTP_ROUTE_MAX_PARAMS) goto invalid;
+                node = http_router_named_child(router, &router->nodes[node].param, rest + 1, name_len - 1);
+            }
+            if (!node) goto clash;
+            params++;
+            pos += name_len;
+            continue;
+        }
+
+        size_t run = 1;
+        while (pos + run < len && !http_router_special(pattern, pos + run)) run++;
+
+        uint8_t* link = &router->nodes[node].child;
+        while (*link && router->nodes[*link].prefix[0] != rest[0]) {
+            link = &router->nodes[*link].sibling;
+        }
+
+        if (*link == 0) {
+            node = http_router_new_node(router, rest, run);
+            if (!node) return false;
+            *link = node;
+            pos += run;
+            continue;
+        }
+
+        http_router_node_t* child = &router->nodes[*link];
+        size_t common = http_router_common(child->prefix, child->prefix_len, rest, run);
+        if (common < child->prefix_len) {
+            // Split: the tail of the child moves into a new node below it
+            uint8_t tail = http_router_new_node(router, child->prefix + common, child->prefix_len - common);
+            if (!tail) return false;
+            child = &router->nodes[*link];
+            http_router_node_t* t = &router->nodes[tail];
+            t->child = child->child;
+            t->param = child->param;
+            t->wildcard = child->wildcard;
+            t->value = child->value;
+            child->prefix_len = common;
+            child->child = tail;
+            child->param = 0;
+            child->wildcard = 0;
+            child->value = NULL;
+        }
+        node = *link;
+        pos += common;
+    }
+
+    if (router->nodes[node].value) goto clash;
+    router->nodes[node].value = value;
+    return true;
+
+clash:
+    printf("Erro: rota %s conflita com outra rota\n", pattern);
+    return false;
+invalid:
+    printf("Erro: rota %s invalida\n", pattern);
+    return false;
+}
+
+static bool http_router_capture(http_route_params_t* params, const http_router_node_t* node, const char* value, size_t value_len){
+    if (params->count >= HTTP_ROUTE_MAX_PARAMS) return false;
+    params->items[params->count++] = (http_route_param_t){
+        .name = node->prefix, .name_len = node->prefix_len, .value = value, .value_len = value_len
+    };
+    return true;
+}
+
+static const void* http_router_walk(const http_router_t* router, uint8_t index, const char* path, size_t len, http_route_params_t* params){
+    const http_router_node_t* node = &router->nodes[index];
+
+    if (len == 0 && node->value) return node->value;
+
+    // Static children: at most one starts with the next byte
+    if (len > 0) {
+        for (uint8_t c = node->child; c; c = router->nodes[c].sibling) {
+            const http_router_node_t* child = &router->nodes[c];
+            if (child->prefix[0] != path[0]) continue;
+            if (child->prefix_len <= len && memcmp(child->prefix, path, child->prefix_len) == 0) {
+                const void* value = http_router_walk(router, c, path + child->prefix_len, len - child->prefix_len, params);
+                if (value) return value;
+            }
+            break;
+        }
+    }
+
+    if (node->param && len > 0 && path[0] != '/') {
+        size_t segment = 0;
+        while (segment < len && path[segment] != '/') segment++;
+        uint8_t mark = params->count;
+        if (http_router_capture(params, &router->nodes[node->param], path, segment)) {
+            const void* value = http_router_walk(router, node->param, path + segment, len - segment, params);
+            if (value) return value;
+        }
+        params->count = mark;
+    }
+
+    if (node->wildcard) {
+        const http_router_node_t* wildcard = &router->nodes[node->wildcard];
+        if (wildcard->value && http_router_capture(params, wildcard, path, len)) return wildcard->value;
+    }
+    return NULL;
+}
+
+const void* http_router_match(const http_router_t* router, const char* path, size_t len, http_route_params_t* params){
+    params->count = 0;
+    if (router->count == 0) return NULL;
+    return http_router_walk(router, 0, path, len, params);
+}
+
+const char* http_route_param(const http_route_params_t* params, const char* name, size_t* len){
+    size_t name_len = strlen(name);
+    for (uint8_t i = 0; i < params->count; i++) {
+        const http_route_param_t* p = &params->items[i];
+        if (p->name_len == name_len && memcmp(p->name, name, name_len) == 0) {
+            if (len) *len = p->value_len;
+            return p->value;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,83 @@
+// Time to encode the same status record as CBOR (cbor.h) and as JSON text
+// with snprintf, the way producers build their messages otherwise, and
+// the size of each. From the repository root:
+//
+//   gcc -O2 -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/cbor_bench.c picow_websockets/cbor.c -o cbor_bench && ./cbor_bench
+
+#include <assert.h>
+#include <stdio.h>
+#include <time.h>
+#include "cbor.h"
+
+#define RECORDS 1000000
+
+typedef struct {
+    uint32_t uptime_ms;
+    float    temperature;
+    uint32_t clients;
+    int32_t  rssi;
+    bool     led;
+} status_t;
+
+static size_t encode_cbor(const status_t* s, uint8_t* buf, size_t cap){
+    cbor_writer_t w;
+    cbor_writer_init(&w, buf, cap);
+    cbor_put_map(&w, 5);
+    cbor_put_cstr(&w, "uptime");
+    cbor_put_uint(&w, s->uptime_ms);
+    cbor_put_cstr(&w, "temp");
+    cbor_put_float(&w, s->temperature);
+    cbor_put_cstr(&w, "clients");
+    cbor_put_uint(&w, s->clients);
+    cbor_put_cstr(&w, "rssi");
+    cbor_put_int(&w, s->rssi);
+    cbor_put_cstr(&w, "led");
+    cbor_put_bool(&w, s->led);
+    return w.overflow ? 0 : w.len;
+}
+
+static size_t encode_json(const status_t* s, uint8_t* buf, size_t cap){
+    int len = snprintf((char*)buf, cap,
+                       "{\"uptime\":%u,\"temp\":%.2f,\"clients\":%u,\"rssi\":%d,\"led\":%s}",
+                       (unsigned)s->uptime_ms, s->temperature, (unsigned)s->clients,
+                       (int)s->rssi, s->led ? "true" : "false");
+    return len > 0 && (size_t)len < cap ? len : 0;
+}
+
+static double now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static volatile size_t sink;
+
+static double run(size_t (*encode)(const status_t*, uint8_t*, size_t), size_t* size){
+    static uint8_t buf[128];
+    status_t s = {0, 20.0f, 0, -40, false};
+    double start = now_ns();
+    for (uint32_t i = 0; i < RECORDS; i++) {
+        s.uptime_ms = i * 1000;
+        s.temperature = 20.0f + (i % 100) * 0.25f;
+        s.clients = i % 8;
+        s.rssi = -40 - (int32_t)(i % 50);
+        s.led = i & 1;
+        *size = encode(&s, buf, sizeof(buf));
+        assert(*size > 0);
+        sink += *size;
+    }
+    return (now_ns() - start) / RECORDS;
+}
+
+int main(void){
+    size_t cbor_size, json_size;
+    double cbor_ns = run(encode_cbor, &cbor_size);
+    double json_ns = run(encode_json, &json_size);
+
+    printf("%-14s %10s %8s\n", "encoder", "ns/record", "bytes");
+    printf("%-14s %10.1f %8u\n", "cbor", cbor_ns, (unsigned)cbor_size);
+    printf("%-14s %10.1f %8u\n", "snprintf json", json_ns, (unsigned)json_size);
+    printf("cbor_bench: %.1fx faster, %.0f%% of the size\n", json_ns / cbor_ns, 100.0 * cbor_size / json_size);
+    return 0;
+}
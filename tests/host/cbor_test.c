@@ -0,0 +1,205 @@
+// Host test for the CBOR encoder and decoder: integers take the shortest
+// head at every width boundary and read back unchanged, negative integers
+// down to INT64_MIN, half-precision floats decode (subnormals, infinities
+// and NaN included), and cbor_skip steps over nested items but refuses every
+// truncated prefix of them. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/cbor_test.c picow_websockets/cbor.c -o cbor_test && ./cbor_test
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "cbor.h"
+
+static uint8_t buf[256];
+
+static size_t encode_uint(uint64_t value){
+    cbor_writer_t w;
+    cbor_writer_init(&w, buf, sizeof(buf));
+    assert(cbor_put_uint(&w, value));
+    return w.len;
+}
+
+static size_t encode_int(int64_t value){
+    cbor_writer_t w;
+    cbor_writer_init(&w, buf, sizeof(buf));
+    assert(cbor_put_int(&w, value));
+    return w.len;
+}
+
+static void check_uint(uint64_t value, size_t len, uint8_t head){
+    assert(encode_uint(value) == len);
+    assert(buf[0] == head);
+
+    cbor_reader_t r;
+    uint64_t out;
+    cbor_reader_init(&r, buf, len);
+    assert(cbor_get_uint(&r, &out) && out == value && r.pos == len);
+}
+
+static void check_int(int64_t value, size_t len, uint8_t head){
+    assert(encode_int(value) == len);
+    assert(buf[0] == head);
+
+    cbor_reader_t r;
+    int64_t out;
+    cbor_reader_init(&r, buf, len);
+    assert(cbor_get_int(&r, &out) && out == value && r.pos == len);
+}
+
+static float decode_float(const uint8_t* in, size_t len){
+    cbor_reader_t r;
+    float out;
+    cbor_reader_init(&r, in, len);
+    assert(cbor_peek_type(&r) == CBOR_TYPE_FLOAT || cbor_peek_type(&r) == CBOR_TYPE_UINT ||
+           cbor_peek_type(&r) == CBOR_TYPE_NEGINT);
+    assert(cbor_get_float(&r, &out) && r.pos == len);
+    return out;
+}
+
+static float decode_half(uint16_t half){
+    uint8_t in[3] = {0xF9, half >> 8, half & 0xFF};
+    return decode_float(in, sizeof(in));
+}
+
+// {"a": [1, -2, {"b": h'0102'}, "xyz", tag(1, 1000)], "c": true, "d": null, "e": 1.5}
+static size_t encode_nested(void){
+    static const uint8_t bytes[] = {1, 2};
+    cbor_writer_t w;
+    cbor_writer_init(&w, buf, sizeof(buf));
+    cbor_put_map(&w, 4);
+    cbor_put_cstr(&w, "a");
+    cbor_put_array(&w, 5);
+    cbor_put_uint(&w, 1);
+    cbor_put_int(&w, -2);
+    cbor_put_map(&w, 1);
+    cbor_put_cstr(&w, "b");
+    cbor_put_bytes(&w, bytes, sizeof(bytes));
+    cbor_put_cstr(&w, "xyz");
+    cbor_put_raw(&w, (const uint8_t[]){0xC1, 0x19, 0x03, 0xE8}, 4);
+    cbor_put_cstr(&w, "c");
+    cbor_put_bool(&w, true);
+    cbor_put_cstr(&w, "d");
+    cbor_put_null(&w);
+    cbor_put_cstr(&w, "e");
+    cbor_put_float(&w, 1.5f);
+    assert(!w.overflow);
+    return w.len;
+}
+
+int main(void){
+    // Unsigned: inline, then 1, 2, 4 and 8 byte arguments
+    check_uint(0, 1, 0x00);
+    check_uint(23, 1, 0x17);
+    check_uint(24, 2, 0x18);
+    check_uint(UINT8_MAX, 2, 0x18);
+    check_uint(UINT8_MAX + 1, 3, 0x19);
+    check_uint(UINT16_MAX, 3, 0x19);
+    check_uint(UINT16_MAX + 1, 5, 0x1A);
+    check_uint(UINT32_MAX, 5, 0x1A);
+    check_uint((uint64_t)UINT32_MAX + 1, 9, 0x1B);
+    check_uint(UINT64_MAX, 9, 0x1B);
+
+    // Signed: -1 - n is encoded, so the boundaries sit one further out
+    check_int(INT64_MAX, 9, 0x1B);
+    check_int(-1, 1, 0x20);
+    check_int(-24, 1, 0x37);
+    check_int(-25, 2, 0x38);
+    check_int(-256, 2, 0x38);
+    check_int(-257, 3, 0x39);
+    check_int(-65536, 3, 0x39);
+    check_int(-65537, 5, 0x3A);
+    check_int(-4294967296, 5, 0x3A);
+    check_int(-4294967297, 9, 0x3B);
+    check_int(INT64_MIN, 9, 0x3B);
+
+    // Not representable as int64_t, nor as uint64_t: refused, position kept
+    cbor_reader_t r;
+    int64_t i;
+    uint64_t u;
+    encode_uint(UINT64_MAX);
+    cbor_reader_init(&r, buf, 9);
+    assert(!cbor_get_int(&r, &i) && r.pos == 0);
+    encode_int(-1);
+    cbor_reader_init(&r, buf, 1);
+    assert(!cbor_get_uint(&r, &u) && r.pos == 0);
+
+    // Half precision
+    assert(decode_half(0x0000) == 0.0f);
+    assert(decode_half(0x3C00) == 1.0f);
+    assert(decode_half(0xC000) == -2.0f);
+    assert(decode_half(0x3E00) == 1.5f);
+    assert(decode_half(0x7BFF) == 65504.0f);
+    assert(decode_half(0x0400) == ldexpf(1, -14));
+    assert(decode_half(0x0001) == ldexpf(1, -24));
+    assert(decode_half(0x03FF) == ldexpf(1023, -24));
+    assert(decode_half(0x7C00) == INFINITY);
+    assert(decode_half(0xFC00) == -INFINITY);
+    assert(isnan(decode_half(0x7E00)));
+    float zero = decode_half(0x8000);
+    assert(zero == 0.0f && signbit(zero));
+
+    // Single, double, and integers read as floats
+    cbor_writer_t w;
+    cbor_writer_init(&w, buf, sizeof(buf));
+    assert(cbor_put_float(&w, -0.15625f) && w.len == 5 && buf[0] == 0xFA);
+    assert(decode_float(buf, 5) == -0.15625f);
+    assert(decode_float((const uint8_t[]){0xFB, 0x40, 0x09, 0x21, 0xFB, 0x54, 0x44, 0x2D, 0x18}, 9) == (float)M_PI);
+    assert(decode_float((const uint8_t[]){0x19, 0x03, 0xE8}, 3) == 1000.0f);
+    assert(decode_float((const uint8_t[]){0x38, 0x63}, 2) == -100.0f);
+
+    // Text and byte strings, zero-copy
+    const char* text;
+    size_t len;
+    cbor_writer_init(&w, buf, sizeof(buf));
+    cbor_put_cstr(&w, "hello");
+    cbor_reader_init(&r, buf, w.len);
+    assert(cbor_get_text(&r, &text, &len) && len == 5 && memcmp(text, "hello", 5) == 0);
+    assert(text == (const char*)buf + 1);
+
+    // The writer stops at the end of its buffer and says so
+    cbor_writer_init(&w, buf, 4);
+    assert(!cbor_put_uint(&w, UINT32_MAX));
+    assert(w.overflow);
+    assert(!cbor_put_uint(&w, 1));
+
+    // Skipping a nested item lands exactly at its end
+    size_t nested = encode_nested();
+    buf[nested] = 0xF6;
+    cbor_reader_init(&r, buf, nested + 1);
+    assert(cbor_skip(&r) && r.pos == nested);
+    assert(cbor_get_null(&r) && r.pos == nested + 1);
+
+    // Skipping within: the map's values one by one
+    size_t count;
+    cbor_reader_init(&r, buf, nested);
+    assert(cbor_get_map(&r, &count) && count == 4);
+    for (size_t k = 0; k < count; k++) {
+        assert(cbor_get_text(&r, &text, &len) && len == 1);
+        assert(cbor_skip(&r));
+    }
+    assert(r.pos == nested);
+
+    // Every truncated prefix is refused, and the reader does not move
+    for (size_t cut = 0; cut < nested; cut++) {
+        cbor_reader_init(&r, buf, cut);
+        assert(!cbor_skip(&r) && r.pos == 0);
+    }
+
+    // Counts larger than what is left of the input are refused up front
+    cbor_reader_init(&r, (const uint8_t[]){0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00}, 10);
+    assert(!cbor_skip(&r) && r.pos == 0);
+    cbor_reader_init(&r, (const uint8_t[]){0xBA, 0x80, 0x00, 0x00, 0x00, 0x00}, 6);
+    assert(!cbor_skip(&r) && r.pos == 0);
+    cbor_reader_init(&r, (const uint8_t[]){0x7A, 0x00, 0x01, 0x00, 0x00, 'a'}, 6);
+    assert(!cbor_skip(&r) && r.pos == 0);
+
+    // Indefinite lengths are not supported
+    cbor_reader_init(&r, (const uint8_t[]){0x9F, 0x01, 0xFF}, 3);
+    assert(!cbor_skip(&r) && r.pos == 0);
+
+    printf("cbor_test: ok\n");
+    return 0;
+}
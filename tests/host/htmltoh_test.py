@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+# Regression check for the minifiers of htmltoh.py: strings, template
+# literals, regular expressions and comments are told apart before any
+# whitespace is touched, and whitespace between inline elements stays. From
+# the repository root:
+#
+#   python3 tests/host/htmltoh_test.py
+
+import os
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+from htmltoh import minify_css, minify_html, minify_js
+
+def check(got, expected):
+    assert got == expected, f"\n got:      {got!r}\n expected: {expected!r}"
+
+# CSS: strings kept as they are, comments removed only outside them
+check(minify_css('a::before { content: "a  ;  b , c" ; }'), 'a::before{content:"a  ;  b , c"}')
+check(minify_css("p { font-family: 'Segoe UI' , sans-serif }"), "p{font-family:'Segoe UI',sans-serif}")
+check(minify_css('a { content: "/* no */" } /* yes "x" */ b { color: red }'), 'a{content:"/* no */"}b{color:red}')
+check(minify_css('q { quotes: "\\"" "\\"" }'), 'q{quotes:"\\"" "\\""}')
+
+# JS: indentation and comments go, line breaks stay
+check(minify_js('  let a = 1;   // one\n\n  /* two */ let b = 2;\n'), 'let a = 1;\nlet b = 2;')
+check(minify_js('f(a,\n  /* multi\n     line */ b)'), 'f(a,\nb)')
+
+# Strings: what looks like a comment or a template is just text
+check(minify_js("  const url = 'http://x/  y';  "), "const url = 'http://x/  y';")
+check(minify_js('  s = "`";\n    t = 1;'), 's = "`";\nt = 1;')
+check(minify_js("  s = 'it\\'s /* not */ `x`';\n  t = 2;"), "s = 'it\\'s /* not */ `x`';\nt = 2;")
+
+# Backticks in comments are not templates
+check(minify_js('  // use `x`\n    a = 1;\n    b = 2;'), 'a = 1;\nb = 2;')
+
+# Templates: kept whole, indentation and nested templates included
+template = 'el.innerHTML = `\n    <li>${items.map(i => `<b>${i}</b>`).join(\'\')}</li>\n  // kept\n`;'
+check(minify_js('    ' + template + '\n    done();'), template + '\ndone();')
+
+# Regular expressions and divisions
+check(minify_js('  s = s.replace(/\\/\\/ +/g, "");'), 's = s.replace(/\\/\\/ +/g, "");')
+check(minify_js('  x = a / b / c;  // half'), 'x = a / b / c;')
+check(minify_js('  return /[/]"/.test(s);'), 'return /[/]"/.test(s);')
+
+# HTML: whitespace between inline elements becomes one space, and only goes
+# around tags that do not show
+check(minify_html('<p>\n  <b>bold</b>\n  <i>italic</i>\n</p>'), '<p> <b>bold</b> <i>italic</i> </p>')
+check(minify_html('<html>\n<head>\n  <title>T</title>\n</head>\n<body>\n  <span>a</span>\n</body>\n</html>'),
+      '<html><head><title>T</title></head><body><span>a</span></body></html>')
+check(minify_html('<pre>  a\n    b</pre>\n<p>x</p>'), '<pre>  a\n    b</pre> <p>x</p>')
+check(minify_html('<p>a</p>\n<script>\n  s = "  </p>  ";\n</script>'), '<p>a</p><script>s = "  </p>  ";</script>')
+check(minify_html('<style>\n  a { content: "  x  " }\n</style>\n<p>y</p>'), '<style>a{content:"  x  "}</style><p>y</p>')
+
+print("htmltoh_test: ok")
@@ -0,0 +1,117 @@
+// Host test for captive-portal probes: each probe path gets the redirect to
+// the portal or, with HTTP_CAPTIVE_ONLINE, the answer its OS expects, with
+// a Content-Length that matches the body. Only exact paths are probes, and
+// a registered route with the same path wins. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/http_captive_test.c tests/host/http_fake.c src/http.c
+//       src/http_parser.c src/http_router.c src/http_query.c
+//       picow_websockets/ws_pool.c -o http_captive_test && ./http_captive_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "http.h"
+#include "http_fake.h"
+
+typedef struct {
+    const char* path;
+    const char* status;   // online answer, NULL if the probe always redirects
+    const char* body;
+} probe_t;
+
+static const probe_t probes[] = {
+    {"/generate_204", "204 No Content", ""},
+    {"/gen_204", "204 No Content", ""},
+    {"/hotspot-detect.html", "200 OK", "<HTML><HEAD><TITLE>Success</TITLE></HEAD><BODY>Success</BODY></HTML>"},
+    {"/library/test/success.html", "200 OK", "<HTML><HEAD><TITLE>Success</TITLE></HEAD><BODY>Success</BODY></HTML>"},
+    {"/connecttest.txt", "200 OK", "Microsoft Connect Test"},
+    {"/ncsi.txt", "200 OK", "Microsoft NCSI"},
+    {"/success.txt", "200 OK", "success\n"},
+    {"/canonical.html", "200 OK", "<meta http-equiv=\"refresh\" content=\"0;url=https://support.mozilla.org/kb/captive-portal\"/>"},
+    {"/redirect", NULL, NULL},
+};
+
+static char body[256];
+
+static void get(const char* path){
+    char req[128];
+    snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: example.com\r\n\r\n", path);
+    http_fake_accept();
+    assert(http_fake_request(req) == ERR_OK);
+    http_fake_drain();
+}
+
+// The status line is `status`, the body `expected`, and the declared
+// Content-Length agrees with it
+static void check(const char* status, const char* expected){
+    char line[64];
+    snprintf(line, sizeof(line), "HTTP/1.1 %s\r\n", status);
+    assert(strncmp(http_fake_out, line, strlen(line)) == 0);
+
+    const char* length = strstr(http_fake_out, "Content-Length: ");
+    assert(length && strtoul(length + 16, NULL, 10) == strlen(expected));
+    assert(http_fake_body(body, sizeof(body)) == (long)strlen(expected));
+    assert(memcmp(body, expected, strlen(expected)) == 0);
+}
+
+static void check_redirect(void){
+    check("302 Found", "");
+    assert(strstr(http_fake_out, "Location: http://picow.local/\r\n"));
+}
+
+static void home(char* query, char* buf, size_t len){
+    snprintf(buf, len, HTTP_HEADER "home");
+}
+
+int main(void){
+    add_http_route("/", home);
+
+    // The default policy sends every probe to the portal, and closes
+    for (size_t i = 0; i < count_of(probes); i++) {
+        get(probes[i].path);
+        check_redirect();
+        assert(http_fake_shut_tx || http_fake_closed);
+    }
+
+    // Online: what each OS expects, in flash and written as it is
+    http_set_captive_policy(HTTP_CAPTIVE_ONLINE);
+    for (size_t i = 0; i < count_of(probes); i++) {
+        get(probes[i].path);
+        if (probes[i].status) {
+            check(probes[i].status, probes[i].body);
+            assert(strstr(http_fake_out, "Cache-Control: no-cache"));
+        } else {
+            check_redirect();
+        }
+        assert(http_fake_shut_tx || http_fake_closed);
+    }
+
+    // The query string is not part of the path
+    get("/generate_204?t=1");
+    check("204 No Content", "");
+
+    // Exact paths only
+    static const char* near[] = {"/generate_2040", "/generate_20", "/generate_204/", "/Generate_204",
+                                 "/redirect/x", "/redirects", "/ncsi.txt.bak", "/x/success.txt"};
+    for (size_t i = 0; i < count_of(near); i++) {
+        get(near[i]);
+        assert(strncmp(http_fake_out, "HTTP/1.1 404", 12) == 0);
+    }
+
+    // Normal pages are untouched, and a route registered on a probe path wins
+    get("/");
+    assert(strcmp(strstr(http_fake_out, "\r\n\r\n") + 4, "home") == 0);
+    add_http_route("/success.txt", home);
+    get("/success.txt");
+    assert(strcmp(strstr(http_fake_out, "\r\n\r\n") + 4, "home") == 0);
+
+    // Back to redirecting, e.g. for a device that has not been through the portal
+    http_set_captive_policy(HTTP_CAPTIVE_REDIRECT);
+    get("/hotspot-detect.html");
+    check_redirect();
+
+    printf("http_captive_test: ok\n");
+    return 0;
+}
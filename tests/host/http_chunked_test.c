@@ -0,0 +1,123 @@
+// Host test for chunked routes: the producer is asked for chunks sized to
+// the free send buffer, so every acknowledgement refills the copy window,
+// short and empty bodies are framed right, a pipelined request is answered
+// after the last chunk, and HTTP/1.0 clients get the raw body ended by the
+// close. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/http_chunked_test.c tests/host/http_fake.c src/http.c
+//       src/http_parser.c src/http_router.c src/http_query.c
+//       picow_websockets/ws_pool.c -o http_chunked_test && ./http_chunked_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "http.h"
+#include "http_fake.h"
+
+#define LOG_LEN 20000
+
+static char log_text[LOG_LEN];
+static char body[LOG_LEN + 1];
+
+// Hands out as much of the log as asked, checking it is asked in order and
+// never for more than the send buffer can take
+static size_t log_calls;
+
+static size_t produce_log(size_t offset, char* buffer, size_t len, void* arg){
+    assert(offset <= LOG_LEN);
+    assert(len > 0 && len <= HTTP_STREAM_CHUNK_SIZE && len < tcp_sndbuf(&http_fake_pcb));
+    log_calls++;
+    if (len > LOG_LEN - offset) len = LOG_LEN - offset;
+    memcpy(buffer, log_text + offset, len);
+    return len;
+}
+
+// A few bytes per call, whatever the room
+static size_t produce_lines(size_t offset, char* buffer, size_t len, void* arg){
+    static const char line[] = "line\n";
+    if (offset == 10 * (sizeof(line) - 1)) return 0;
+    memcpy(buffer, line, sizeof(line) - 1);
+    return sizeof(line) - 1;
+}
+
+static size_t produce_nothing(size_t offset, char* buffer, size_t len, void* arg){
+    return 0;
+}
+
+static void request(const char* path, const char* version){
+    char req[96];
+    snprintf(req, sizeof(req), "GET %s %s\r\nHost: picow\r\n\r\n", path, version);
+    assert(http_fake_request(req) == ERR_OK);
+}
+
+int main(void){
+    for (size_t i = 0; i < LOG_LEN; i++) log_text[i] = i % 64 == 63 ? '\n' : 'a' + i % 26;
+    add_http_chunked_route("/log", "text/plain", produce_log, NULL);
+    add_http_chunked_route("/lines", "text/plain", produce_lines, NULL);
+    add_http_chunked_route("/empty", "text/plain", produce_nothing, NULL);
+
+    // Every acknowledgement refills the copy window up to a chunk's framing,
+    // and the producer fills the scratch buffer on all but one call a round
+    http_fake_accept();
+    request("/log", "HTTP/1.1");
+    assert(strstr(http_fake_out, "Transfer-Encoding: chunked\r\n"));
+    assert(!strstr(http_fake_out, "Content-Length"));
+    int rounds = 0;
+    while (http_fake_body(body, sizeof(body)) < 0) {
+        size_t before = http_fake_out_len;
+        http_fake_ack();
+        size_t queued = http_fake_out_len - before;
+        assert(queued > 0);
+        if (http_fake_body(body, sizeof(body)) < 0) assert(queued + 16 >= HTTP_STREAM_COPY_WINDOW);
+        rounds++;
+    }
+    assert(rounds <= LOG_LEN / (HTTP_STREAM_COPY_WINDOW - 16) + 1);
+    assert(log_calls <= LOG_LEN / HTTP_STREAM_CHUNK_SIZE + rounds + 2);
+    assert(http_fake_body(body, sizeof(body)) == LOG_LEN && memcmp(body, log_text, LOG_LEN) == 0);
+    assert(http_fake_max_unacked <= HTTP_STREAM_COPY_WINDOW + 256);
+    assert(!http_fake_closed && !http_fake_shut_tx);
+
+    // A small send buffer: the first chunk is cut to what is left of it
+    http_fake_accept();
+    http_fake_pcb.snd_buf = 400;
+    request("/log", "HTTP/1.1");
+    assert(http_fake_out_len <= 400);
+    http_fake_drain();
+    assert(http_fake_body(body, sizeof(body)) == LOG_LEN && memcmp(body, log_text, LOG_LEN) == 0);
+
+    // Short chunks, then an empty body: just the last chunk
+    http_fake_accept();
+    request("/lines", "HTTP/1.1");
+    http_fake_drain();
+    assert(http_fake_body(body, sizeof(body)) == 50 && strncmp(body, "line\nline\n", 10) == 0);
+    assert(strstr(http_fake_out, "\r\n5\r\nline\n\r\n"));
+
+    http_fake_clear();
+    request("/empty", "HTTP/1.1");
+    http_fake_drain();
+    assert(http_fake_body(body, sizeof(body)) == 0);
+    assert(strcmp(strstr(http_fake_out, "\r\n\r\n"), "\r\n\r\n0\r\n\r\n") == 0);
+    assert(!http_fake_closed && !http_fake_shut_tx);
+
+    // Pipelined: the second response follows the last chunk of the first
+    http_fake_accept();
+    assert(http_fake_request("GET /lines HTTP/1.1\r\nHost: picow\r\n\r\n"
+                             "GET /empty HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    http_fake_drain();
+    const char* second = strstr(http_fake_out, "0\r\n\r\nHTTP/1.1 200 OK\r\n");
+    assert(second && strcmp(strstr(second + 5, "\r\n\r\n"), "\r\n\r\n0\r\n\r\n") == 0);
+    assert(!http_fake_closed && !http_fake_shut_tx);
+
+    // HTTP/1.0: no chunks, the body ends with the connection
+    http_fake_accept();
+    request("/log", "HTTP/1.0");
+    http_fake_drain();
+    assert(strstr(http_fake_out, "Connection: close\r\n"));
+    assert(!strstr(http_fake_out, "Transfer-Encoding"));
+    assert(http_fake_body(body, sizeof(body)) == LOG_LEN && memcmp(body, log_text, LOG_LEN) == 0);
+    assert(http_fake_shut_tx || http_fake_closed);
+
+    printf("http_chunked_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Host test for the HTTP listener's connection cap: with every slot taken by
+// an idle keep-alive connection, a new client evicts the one idle the
+// longest instead of getting 503. lwIP is replaced by the stubs next to this
+// file, so it builds with any C compiler. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/http_evict_test.c src/http.c src/http_parser.c
+//       src/http_router.c src/http_query.c picow_websockets/ws_pool.c
+//       -o http_evict_test && ./http_evict_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "http.h"
+#include "ws_governor.h"
+
+char dnss_captive_site[64] = "picow.local";
+const ip_addr_t ip_addr_any;
+
+// lwIP: one pcb per client, callbacks recorded so the test can drive them
+#define CLIENTS (HTTP_MAX_CONNECTIONS + 1)
+
+static struct tcp_pcb listener;
+static struct tcp_pcb clients[CLIENTS];
+static bool closed[CLIENTS];
+static tcp_accept_fn accept_fn;
+static tcp_recv_fn recv_fn;
+static tcp_poll_fn poll_fn;
+
+static int client_index(struct tcp_pcb* pcb){
+    return pcb == &listener ? -1 : (int)(pcb - clients);
+}
+
+struct tcp_pcb* tcp_new(void){ return &listener; }
+err_t tcp_bind(struct tcp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port){ return ERR_OK; }
+struct tcp_pcb* tcp_listen_with_backlog(struct tcp_pcb* pcb, u8_t backlog){ return pcb; }
+void tcp_accept(struct tcp_pcb* pcb, tcp_accept_fn accept){ accept_fn = accept; }
+void tcp_arg(struct tcp_pcb* pcb, void* arg){ pcb->callback_arg = arg; }
+void tcp_recv(struct tcp_pcb* pcb, tcp_recv_fn recv){ if (recv) recv_fn = recv; }
+void tcp_sent(struct tcp_pcb* pcb, tcp_sent_fn sent){}
+void tcp_err(struct tcp_pcb* pcb, tcp_err_fn err){}
+void tcp_poll(struct tcp_pcb* pcb, tcp_poll_fn poll, u8_t interval){ if (poll) poll_fn = poll; }
+void tcp_recved(struct tcp_pcb* pcb, u16_t len){}
+err_t tcp_output(struct tcp_pcb* pcb){ return ERR_OK; }
+void tcp_abort(struct tcp_pcb* pcb){ closed[client_index(pcb)] = true; }
+err_t tcp_close(struct tcp_pcb* pcb){ closed[client_index(pcb)] = true; return ERR_OK; }
+err_t tcp_shutdown(struct tcp_pcb* pcb, int shut_rx, int shut_tx){ return ERR_OK; }
+err_t tcp_write(struct tcp_pcb* pcb, const void* data, u16_t len, u8_t flags){
+    if (len > pcb->snd_buf) return ERR_MEM;
+    pcb->snd_buf -= len;
+    return ERR_OK;
+}
+u8_t pbuf_free(struct pbuf* p){ return 1; }
+struct pbuf* pbuf_skip(struct pbuf* in, u16_t in_offset, u16_t* out_offset){
+    while (in && in_offset >= in->len) {
+        in_offset -= in->len;
+        in = in->next;
+    }
+    if (out_offset) *out_offset = in_offset;
+    return in;
+}
+
+// Governor and WebSocket layer: plenty of memory, no upgrades
+bool ws_governor_admit(void){ return true; }
+err_t ws_governor_reject(struct tcp_pcb* pcb){ closed[client_index(pcb)] = true; return ERR_OK; }
+WS_GOV_LEVEL ws_governor_level(void){ return WS_GOV_NORMAL; }
+err_t websocket_schema_upgrade(char* payload, struct tcp_pcb* pcb, struct pbuf* p){ return ERR_OK; }
+
+static void page(char* query, char* buf, size_t len){
+    snprintf(buf, len, HTTP_HEADER "ok");
+}
+
+static void connect_client(int i){
+    clients[i] = (struct tcp_pcb){.state = ESTABLISHED, .snd_buf = TCP_SND_BUF};
+    assert(accept_fn(NULL, &clients[i], ERR_OK) == ERR_OK);
+}
+
+static void request(int i){
+    static char req[] = "GET /page HTTP/1.1\r\nHost: picow\r\n\r\n";
+    struct pbuf p = {.payload = req, .len = sizeof(req) - 1, .tot_len = sizeof(req) - 1};
+    assert(recv_fn(clients[i].callback_arg, &clients[i], &p, ERR_OK) == ERR_OK);
+    clients[i].snd_buf = TCP_SND_BUF;   // response acknowledged
+}
+
+int main(void){
+    add_http_route("/page", page);
+    start_http_server();
+
+    // Every slot holds a keep-alive connection that has answered a request
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        connect_client(i);
+        request(i);
+        assert(!closed[i]);
+    }
+
+    // Client 1 has been idle the longest, client 0 a little less
+    for (int round = 0; round < 2; round++) poll_fn(clients[1].callback_arg, &clients[1]);
+    poll_fn(clients[0].callback_arg, &clients[0]);
+
+    // One more: admitted, and only the oldest idle connection goes
+    connect_client(HTTP_MAX_CONNECTIONS);
+    assert(!closed[HTTP_MAX_CONNECTIONS]);
+    assert(clients[HTTP_MAX_CONNECTIONS].callback_arg != NULL);
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        assert(closed[i] == (i == 1));
+    }
+
+    // The newcomer is served like any other
+    request(HTTP_MAX_CONNECTIONS);
+    assert(!closed[HTTP_MAX_CONNECTIONS]);
+
+    printf("http_evict_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "http.h"
+#include "ws_governor.h"
+#include "http_fake.h"
+
+#define HTTP_FAKE_OUT_SIZE (1 << 20)
+
+char dnss_captive_site[64] = "picow.local";
+const ip_addr_t ip_addr_any;
+
+struct tcp_pcb http_fake_pcb;
+char http_fake_out[HTTP_FAKE_OUT_SIZE + 1];
+size_t http_fake_out_len;
+size_t http_fake_recved;
+bool http_fake_closed;
+bool http_fake_aborted;
+bool http_fake_shut_tx;
+int http_fake_writes_left = -1;
+size_t http_fake_max_unacked;
+
+static struct tcp_pcb listener;
+static tcp_accept_fn accept_fn;
+static tcp_recv_fn recv_fn;
+static tcp_sent_fn sent_fn;
+static tcp_poll_fn poll_fn;
+static tcp_err_fn err_fn;
+static size_t unacked;
+
+struct tcp_pcb* tcp_new(void){ return &listener; }
+err_t tcp_bind(struct tcp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port){ return ERR_OK; }
+struct tcp_pcb* tcp_listen_with_backlog(struct tcp_pcb* pcb, u8_t backlog){ return pcb; }
+void tcp_accept(struct tcp_pcb* pcb, tcp_accept_fn accept){ accept_fn = accept; }
+void tcp_arg(struct tcp_pcb* pcb, void* arg){ pcb->callback_arg = arg; }
+void tcp_recv(struct tcp_pcb* pcb, tcp_recv_fn recv){ recv_fn = recv; }
+void tcp_sent(struct tcp_pcb* pcb, tcp_sent_fn sent){ sent_fn = sent; }
+void tcp_err(struct tcp_pcb* pcb, tcp_err_fn err){ err_fn = err; }
+void tcp_poll(struct tcp_pcb* pcb, tcp_poll_fn poll, u8_t interval){ poll_fn = poll; }
+void tcp_recved(struct tcp_pcb* pcb, u16_t len){ http_fake_recved += len; }
+err_t tcp_output(struct tcp_pcb* pcb){ return ERR_OK; }
+
+void tcp_abort(struct tcp_pcb* pcb){
+    http_fake_closed = http_fake_aborted = true;
+    pcb->state = CLOSED;
+}
+
+err_t tcp_close(struct tcp_pcb* pcb){
+    http_fake_closed = true;
+    pcb->state = CLOSED;
+    return ERR_OK;
+}
+
+err_t tcp_shutdown(struct tcp_pcb* pcb, int shut_rx, int shut_tx){
+    if (shut_tx) http_fake_shut_tx = true;
+    return ERR_OK;
+}
+
+err_t tcp_write(struct tcp_pcb* pcb, const void* data, u16_t len, u8_t flags){
+    assert(!http_fake_closed && !http_fake_shut_tx);
+    if (http_fake_writes_left == 0) return ERR_MEM;
+    if (len > pcb->snd_buf || pcb->snd_queuelen >= TCP_SND_QUEUELEN) return ERR_MEM;
+    if (http_fake_writes_left > 0) http_fake_writes_left--;
+    assert(http_fake_out_len + len <= HTTP_FAKE_OUT_SIZE);
+    memcpy(http_fake_out + http_fake_out_len, data, len);
+    http_fake_out_len += len;
+    http_fake_out[http_fake_out_len] = '\0';
+    pcb->snd_buf -= len;
+    pcb->snd_queuelen++;
+    unacked += len;
+    if (unacked > http_fake_max_unacked) http_fake_max_unacked = unacked;
+    return ERR_OK;
+}
+
+u8_t pbuf_free(struct pbuf* p){ return 1; }
+
+struct pbuf* pbuf_skip(struct pbuf* in, u16_t in_offset, u16_t* out_offset){
+    while (in && in_offset >= in->len) {
+        in_offset -= in->len;
+        in = in->next;
+    }
+    if (out_offset) *out_offset = in_offset;
+    return in;
+}
+
+// Governor and WebSocket layer: plenty of memory, no upgrades
+bool ws_governor_admit(void){ return true; }
+err_t ws_governor_reject(struct tcp_pcb* pcb){ return tcp_close(pcb); }
+WS_GOV_LEVEL ws_governor_level(void){ return WS_GOV_NORMAL; }
+err_t websocket_schema_upgrade(char* payload, struct tcp_pcb* pcb, struct pbuf* p){ return ERR_OK; }
+
+void http_fake_accept(void){
+    static bool started;
+    if (!started) start_http_server();
+    started = true;
+
+    // The previous client resets its connection, which frees its slot
+    if (http_fake_pcb.callback_arg && !http_fake_closed) err_fn(http_fake_pcb.callback_arg, ERR_RST);
+
+    http_fake_pcb = (struct tcp_pcb){.state = ESTABLISHED, .snd_buf = TCP_SND_BUF};
+    http_fake_closed = http_fake_aborted = http_fake_shut_tx = false;
+    http_fake_writes_left = -1;
+    http_fake_recved = 0;
+    http_fake_max_unacked = 0;
+    unacked = 0;
+    http_fake_clear();
+    assert(accept_fn(NULL, &http_fake_pcb, ERR_OK) == ERR_OK);
+}
+
+err_t http_fake_deliver(const char* data, size_t len, size_t segment){
+    static struct pbuf chain[256];
+    size_t count = 0;
+    for (size_t off = 0; off < len; off += segment, count++) {
+        assert(count < sizeof(chain) / sizeof(chain[0]));
+        size_t n = len - off < segment ? len - off : segment;
+        chain[count] = (struct pbuf){.payload = (void*)(data + off), .len = n, .tot_len = len - off};
+        if (count) chain[count - 1].next = &chain[count];
+    }
+    return recv_fn(http_fake_pcb.callback_arg, &http_fake_pcb, &chain[0], ERR_OK);
+}
+
+err_t http_fake_request(const char* data){
+    size_t len = strlen(data);
+    return http_fake_deliver(data, len, len);
+}
+
+err_t http_fake_fin(void){
+    http_fake_pcb.state = CLOSE_WAIT;
+    return recv_fn(http_fake_pcb.callback_arg, &http_fake_pcb, NULL, ERR_OK);
+}
+
+err_t http_fake_ack(void){
+    u16_t len = unacked;
+    unacked = 0;
+    http_fake_pcb.snd_buf = TCP_SND_BUF;
+    http_fake_pcb.snd_queuelen = 0;
+    if (http_fake_closed || !http_fake_pcb.callback_arg) return ERR_OK;
+    return sent_fn(http_fake_pcb.callback_arg, &http_fake_pcb, len);
+}
+
+int http_fake_drain(void){
+    int rounds = 0;
+    while (unacked > 0) {
+        http_fake_ack();
+        rounds++;
+    }
+    return rounds;
+}
+
+err_t http_fake_poll(void){
+    if (http_fake_closed || !http_fake_pcb.callback_arg) return ERR_OK;
+    return poll_fn(http_fake_pcb.callback_arg, &http_fake_pcb);
+}
+
+void http_fake_clear(void){
+    http_fake_out_len = 0;
+    http_fake_out[0] = '\0';
+}
+
+static long http_fake_unchunk(const char* at, char* body, size_t size){
+    size_t len = 0;
+    while (true) {
+        char* end;
+        unsigned long n = strtoul(at, &end, 16);
+        if (end == at || strncmp(end, "\r\n", 2) != 0) return -1;
+        at = end + 2;
+        if (n == 0) return strcmp(at, "\r\n") == 0 ? (long)len : -1;
+        if (len + n > size || strlen(at) < n + 2 || strncmp(at + n, "\r\n", 2) != 0) return -1;
+        memcpy(body + len, at, n);
+        len += n;
+        at += n + 2;
+    }
+}
+
+long http_fake_body(char* body, size_t size){
+    const char* end = strstr(http_fake_out, "\r\n\r\n");
+    if (!end) return -1;
+    const char* at = end + 4;
+    size_t len = http_fake_out_len - (at - http_fake_out);
+
+    const char* framing = strstr(http_fake_out, "Transfer-Encoding: chunked\r\n");
+    if (framing && framing < end) return http_fake_unchunk(at, body, size);
+
+    // Without a Content-Length the body runs to the close
+    const char* length = strstr(http_fake_out, "Content-Length: ");
+    if (length && length < end && strtoul(length + 16, NULL, 10) != len) return -1;
+    if (len > size) return -1;
+    memcpy(body, at, len);
+    return len;
+}
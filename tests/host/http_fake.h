@@ -0,0 +1,50 @@
+// Fake lwIP for the HTTP host tests: one client connection at a time,
+// driven through the callbacks http.c registers, with everything the server
+// queues collected in http_fake_out.
+
+#ifndef HTTP_FAKE_H
+#define HTTP_FAKE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lwip/tcp.h"
+
+extern struct tcp_pcb http_fake_pcb;
+extern char http_fake_out[];
+extern size_t http_fake_out_len;
+extern size_t http_fake_recved;     // window credited with tcp_recved()
+extern bool http_fake_closed;       // tcp_close() or tcp_abort()
+extern bool http_fake_aborted;
+extern bool http_fake_shut_tx;      // tcp_shutdown() of the sending side
+extern int http_fake_writes_left;   // tcp_write() calls before ERR_MEM, -1 for no limit
+extern size_t http_fake_max_unacked; // most bytes ever queued and not acknowledged
+
+// Starts the server (once) and accepts a new connection
+void http_fake_accept(void);
+
+// Delivers `len` bytes as a pbuf chain of `segment`-byte pbufs
+err_t http_fake_deliver(const char* data, size_t len, size_t segment);
+
+// Delivers a NUL-terminated request in one pbuf
+err_t http_fake_request(const char* data);
+
+// The client closed its sending side (recv callback with p == NULL)
+err_t http_fake_fin(void);
+
+// The client acknowledged everything queued: frees the send buffer and
+// calls the sent callback
+err_t http_fake_ack(void);
+
+// Acknowledges until the server stops queueing; returns how many rounds
+int http_fake_drain(void);
+
+err_t http_fake_poll(void);
+
+// Forgets the output collected so far
+void http_fake_clear(void);
+
+// Body of the response in http_fake_out, unchunked if it was chunked;
+// returns its length, -1 if the response is incomplete or badly framed
+long http_fake_body(char* body, size_t size);
+
+#endif /* HTTP_FAKE_H */
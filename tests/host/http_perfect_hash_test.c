@@ -0,0 +1,79 @@
+// Host test for PERFECT_HASH_SEARCH: the generated table (routes/assets.h)
+// is served from flash, and routes added one by one still answer, from the
+// radix tree. Built with -DPERFECT_HASH_SEARCH. From the repository root:
+//
+//   gcc -DPERFECT_HASH_SEARCH -I. -Itests/host/stubs -Iincludes -Iconfigs
+//       -Ipicow_websockets tests/host/http_perfect_hash_test.c
+//       tests/host/http_fake.c src/http.c src/http_parser.c src/http_router.c
+//       src/http_query.c picow_websockets/ws_pool.c
+//       -o http_perfect_hash_test && ./http_perfect_hash_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "http.h"
+#include "http_fake.h"
+#include "routes/assets.h"
+
+#ifndef PERFECT_HASH_SEARCH
+#error "build with -DPERFECT_HASH_SEARCH"
+#endif
+
+static void page(char* query, char* buf, size_t len){
+    snprintf(buf, len, HTTP_HEADER "page");
+}
+
+static void item(const http_route_params_t* params, char* query, char* buf, size_t len){
+    size_t id_len;
+    const char* id = http_route_param(params, "id", &id_len);
+    snprintf(buf, len, HTTP_HEADER "item %.*s", (int)id_len, id);
+}
+
+static void writer(http_writer_t* w, const http_route_params_t* params, char* query){
+    http_printf(w, "writer");
+    http_end(w);
+}
+
+static size_t generate(size_t offset, char* buffer, size_t len, void* arg){
+    memset(buffer, 'g', len);
+    return len;
+}
+
+static const char* get(const char* path){
+    static char req[128];
+    snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: picow\r\n\r\n", path);
+    http_fake_accept();
+    assert(http_fake_request(req) == ERR_OK);
+    http_fake_drain();
+    return http_fake_out;
+}
+
+static const char* body(const char* response){
+    const char* at = strstr(response, "\r\n\r\n");
+    return at ? at + 4 : "";
+}
+
+int main(void){
+    add_http_route_table(&http_route_table);
+    add_http_route("/page", page);
+    add_http_param_route("/item/:id", item);
+    add_http_writer_route("/writer", writer);
+    add_http_static_route("/static", "text/plain", HTTP_STATIC_BODY("static"));
+    add_http_generator_route("/generated", "text/plain", 4, generate, NULL);
+
+    // The table
+    assert(strncmp(get("/index"), "HTTP/1.1 200 OK", 15) == 0);
+    assert(strncmp(get("/status"), "HTTP/1.1 200 OK", 15) == 0);
+
+    // Everything else, exact paths included
+    assert(strcmp(body(get("/page")), "page") == 0);
+    assert(strcmp(body(get("/item/7")), "item 7") == 0);
+    assert(strcmp(body(get("/writer")), "writer") == 0);
+    assert(strcmp(body(get("/static")), "static") == 0);
+    assert(strcmp(body(get("/generated")), "gggg") == 0);
+
+    assert(strncmp(get("/nowhere"), "HTTP/1.1 404", 12) == 0);
+
+    printf("http_perfect_hash_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Host test for query strings: percent-decoding, empty values and bare
+// keys, repeated keys, and '%' sequences cut short at the end of a value,
+// which are kept as they are and never read into the next pair. From the
+// repository root:
+//
+//   gcc -Iincludes tests/host/http_query_test.c src/http_query.c
+//       -o http_query_test && ./http_query_test
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include "http_query.h"
+
+static char out[64];
+
+static const char* decode(const char* src){
+    size_t len = http_query_decode(src, strlen(src), out, sizeof(out));
+    assert(len == strlen(out));
+    return out;
+}
+
+static const char* value_of(const char* query, const char* key){
+    http_query_param_t param;
+    if (!http_query_find(query, key, &param)) return NULL;
+    http_query_decode(param.value, param.value_len, out, sizeof(out));
+    return out;
+}
+
+static bool long_of(const char* query, long* value){
+    http_query_param_t param;
+    assert(http_query_find(query, "n", &param));
+    return http_query_value_long(&param, value);
+}
+
+int main(void){
+    // Percent-decoding, either case of hex digit, '+' as a space
+    assert(strcmp(decode("a%20b+c"), "a b c") == 0);
+    assert(strcmp(decode("%2f%2F%7e"), "//~") == 0);
+    assert(strcmp(decode("%41%42%43"), "ABC") == 0);
+    assert(strcmp(decode("%2B"), "+") == 0);
+    assert(strcmp(decode("100%25"), "100%") == 0);
+
+    // Not two hex digits: the '%' is kept, and what follows is not consumed
+    assert(strcmp(decode("%zz%4g"), "%zz%4g") == 0);
+    assert(strcmp(decode("50%"), "50%") == 0);
+    assert(strcmp(decode("%4"), "%4") == 0);
+
+    // Truncated to the destination, always terminated
+    char small[4];
+    assert(http_query_decode("a%20bcdef", 9, small, sizeof(small)) == 3);
+    assert(strcmp(small, "a b") == 0);
+    assert(http_query_decode("abc", 3, small, 0) == 0);
+
+    // A truncated "%X" at the end of a value stops at the value: the next
+    // pair's bytes are not taken as its second hex digit
+    assert(strcmp(value_of("a=%4&b=1", "a"), "%4") == 0);
+    assert(strcmp(value_of("a=%&b=1", "a"), "%") == 0);
+    assert(strcmp(value_of("a=%4&b=1", "b"), "1") == 0);
+    assert(strcmp(value_of("a=x%2", "a"), "x%2") == 0);
+
+    // Empty values, bare keys and empty pairs
+    http_query_param_t param;
+    assert(http_query_find("a=&b", "a", &param) && param.value_len == 0 && param.value);
+    assert(http_query_find("a=&b", "b", &param) && param.value_len == 0 && param.value);
+    assert(http_query_value_equals(&param, ""));
+    assert(http_query_find("=1", "", &param) && http_query_value_equals(&param, "1"));
+    assert(!http_query_find("", "a", &param));
+    assert(!http_query_find(NULL, "a", &param));
+
+    http_query_t q;
+    const char* keys[] = {"a", "b", "a", "c"};
+    size_t n = 0;
+    http_query_init(&q, "&a=1&&b=2&a=3&c&");
+    while (http_query_next(&q, &param)) {
+        assert(n < 4 && param.key_len == strlen(keys[n]) && memcmp(param.key, keys[n], param.key_len) == 0);
+        n++;
+    }
+    assert(n == 4);
+
+    // Repeated keys: find returns the first, the iterator sees them all
+    assert(strcmp(value_of("a=1&b=2&a=3", "a"), "1") == 0);
+
+    // Keys are compared decoded, and as a whole
+    assert(strcmp(value_of("first%20name=Ana+Maria", "first name"), "Ana Maria") == 0);
+    assert(strcmp(value_of("x%3Dy=1", "x=y"), "1") == 0);
+    assert(!value_of("ab=1", "a"));
+    assert(!value_of("a=1", "ab"));
+
+    // Decoded comparison of values
+    assert(http_query_find("led=on%21", "led", &param));
+    assert(http_query_value_equals(&param, "on!"));
+    assert(!http_query_value_equals(&param, "on"));
+    assert(!http_query_value_equals(&param, "on!!"));
+
+    // Numbers
+    long value;
+    assert(long_of("n=42", &value) && value == 42);
+    assert(long_of("n=-7", &value) && value == -7);
+    assert(long_of("n=+7", &value) && value == 7);
+    assert(long_of("n=0", &value) && value == 0);
+    char max[32];
+    snprintf(max, sizeof(max), "n=%ld", LONG_MAX);
+    assert(long_of(max, &value) && value == LONG_MAX);
+    max[strlen(max) - 1]++;
+    assert(!long_of(max, &value));
+    assert(!long_of("n=", &value));
+    assert(!long_of("n", &value));
+    assert(!long_of("n=-", &value));
+    assert(!long_of("n=12x", &value));
+    assert(!long_of("n= 1", &value));
+
+    printf("http_query_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,148 @@
+// Time per GET request with 5, 50 and 500 exact routes, for each route
+// lookup strategy of http.c. Built once per strategy by the Makefile
+// (http_router_bench_linear, _hashmap, _perfect_hash and _radix); every
+// request goes through the same parser and static response code, so what
+// differs between the builds is the lookup. From the repository root, e.g.:
+//
+//   gcc -O2 -DPERFECT_HASH_SEARCH -DHTTP_MAX_STATIC_ROUTES=600
+//       -DHTTP_MAX_PATTERN_ROUTES=600 -DHTTP_ROUTER_MAX_NODES=1024
+//       -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/http_router_bench.c tests/host/http_fake.c src/http.c
+//       src/http_parser.c src/http_router.c src/http_query.c
+//       picow_websockets/ws_pool.c -o http_router_bench && ./http_router_bench
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "http.h"
+#include "http_fake.h"
+
+#if defined(LINEAR_DYNAMIC_ARRAY_SEARCH)
+    #define STRATEGY "linear"
+#elif defined(PERFECT_HASH_SEARCH)
+    #define STRATEGY "perfect hash"
+#elif defined(RADIX_TREE_SEARCH)
+    #define STRATEGY "radix tree"
+#else
+    #define STRATEGY "hashmap"
+#endif
+
+#define MAX_ROUTES 500
+#define REQUESTS   300000
+#define PER_CONN   (HTTP_MAX_REQUESTS_PER_CONNECTION - 1)
+
+static char paths[MAX_ROUTES][32];
+static char requests[MAX_ROUTES][80];
+static http_asset_t assets[MAX_ROUTES];
+
+#ifdef PERFECT_HASH_SEARCH
+// The table htmltoh.py would generate for the first `n` paths (same
+// hash-and-displace search as perfect_hash() there)
+static uint16_t displace[MAX_ROUTES];
+static http_route_slot_t slots[MAX_ROUTES];
+static http_route_table_t table;
+
+static bool build_table(size_t n){
+    size_t buckets = n < 2 ? 1 : (n + 1) / 2;
+    static uint32_t hashes[MAX_ROUTES];
+    static uint16_t members[MAX_ROUTES][MAX_ROUTES / 2 + 1];
+    static uint16_t size[MAX_ROUTES], order[MAX_ROUTES], pos[MAX_ROUTES];
+    static bool taken[MAX_ROUTES];
+
+    for (uint32_t seed = 0; seed < 1000; seed++) {
+        memset(size, 0, sizeof(size));
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = http_route_hash(paths[i], strlen(paths[i]), seed);
+            size_t b = http_route_reduce(hashes[i], buckets);
+            members[b][size[b]++] = i;
+        }
+        // Largest buckets first, while the table is empty
+        for (size_t i = 0; i < buckets; i++) {
+            size_t j = i;
+            for (; j > 0 && size[order[j - 1]] < size[i]; j--) order[j] = order[j - 1];
+            order[j] = i;
+        }
+        memset(taken, 0, sizeof(taken));
+        bool ok = true;
+        for (size_t k = 0; ok && k < buckets && size[order[k]] > 0; k++) {
+            size_t b = order[k];
+            uint32_t d = 0;
+            for (; d < (1u << 16); d++) {
+                size_t m = 0;
+                for (; m < size[b]; m++) {
+                    pos[m] = http_route_reduce(http_route_mix(hashes[members[b][m]] ^ d), n);
+                    if (taken[pos[m]]) break;
+                    taken[pos[m]] = true;
+                }
+                if (m == size[b]) break;
+                while (m-- > 0) taken[pos[m]] = false;
+            }
+            if (d == (1u << 16)) ok = false;
+            displace[b] = d;
+            for (size_t m = 0; ok && m < size[b]; m++) {
+                size_t i = members[b][m];
+                slots[pos[m]] = (http_route_slot_t){paths[i], strlen(paths[i]), i};
+            }
+        }
+        if (!ok) continue;
+
+        table = (http_route_table_t){assets, n, displace, slots, buckets, seed};
+        return true;
+    }
+    return false;
+}
+#endif
+
+static void add_routes(size_t from, size_t to){
+    #ifdef PERFECT_HASH_SEARCH
+        assert(build_table(to));
+        add_http_route_table(&table);
+    #else
+        add_http_assets(assets + from, to - from);
+    #endif
+}
+
+static double now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(void){
+    static const char* dirs[] = {"css", "js", "img", "api/v1"};
+    for (size_t i = 0; i < MAX_ROUTES; i++) {
+        snprintf(paths[i], sizeof(paths[i]), "/%s/item%03u", dirs[i % 4], (unsigned)i);
+        snprintf(requests[i], sizeof(requests[i]), "GET %s HTTP/1.1\r\nHost: picow\r\n\r\n", paths[i]);
+        assets[i] = (http_asset_t){paths[i], "text/plain", (const uint8_t*)"ok", 2};
+    }
+
+    static const size_t stages[] = {5, 50, 500};
+    size_t routes = 0;
+    for (size_t s = 0; s < sizeof(stages) / sizeof(stages[0]); s++) {
+        add_routes(routes, stages[s]);
+        routes = stages[s];
+
+        // Every route answers; then time requests spread over all of them
+        http_fake_accept();
+        assert(http_fake_request(requests[routes - 1]) == ERR_OK);
+        assert(strncmp(http_fake_out, "HTTP/1.1 200 OK", 15) == 0);
+
+        double elapsed = 0;
+        size_t next = 0, done = 0;
+        while (done < REQUESTS) {
+            http_fake_accept();
+            double start = now_ns();
+            for (size_t i = 0; i < PER_CONN; i++, done++) {
+                http_fake_request(requests[next]);
+                http_fake_ack();
+                http_fake_clear();
+                next = (next + 7919) % routes;
+            }
+            elapsed += now_ns() - start;
+        }
+        printf("http_router_bench (%s): %3u routes %6.0f ns/request\n",
+               STRATEGY, (unsigned)routes, elapsed / done);
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Host test for bodies of several hundred KB: flash bodies, generated
+// bodies, chunked bodies and writers are sent whole, with no more than
+// HTTP_STREAM_COPY_WINDOW bytes of a streamed body in flight, also when the
+// client half-closes its side right after the request. From the repository
+// root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/http_stream_test.c tests/host/http_fake.c src/http.c
+//       src/http_parser.c src/http_router.c src/http_query.c
+//       picow_websockets/ws_pool.c -o http_stream_test && ./http_stream_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "http.h"
+#include "http_fake.h"
+
+#define BODY_LEN (300 * 1024)
+
+static char big[BODY_LEN];
+static char body[BODY_LEN + 1];
+
+static size_t generate(size_t offset, char* buffer, size_t len, void* arg){
+    memcpy(buffer, big + offset, len);
+    return len;
+}
+
+static size_t produce(size_t offset, char* buffer, size_t len, void* arg){
+    if (len > BODY_LEN - offset) len = BODY_LEN - offset;
+    memcpy(buffer, big + offset, len);
+    return len;
+}
+
+static size_t written;
+
+static void write_more(http_writer_t* w, void* arg){
+    if (!w) return;
+    written += http_write(w, big + written, BODY_LEN - written);
+    if (written == BODY_LEN) http_end(w);
+}
+
+static void writer(http_writer_t* w, const http_route_params_t* params, char* query){
+    written = 0;
+    http_writer_on_drain(w, write_more, NULL);
+    write_more(w, NULL);
+}
+
+// Requests `path`, optionally followed at once by the client's FIN, and
+// acknowledges until the server has sent everything
+static void get(const char* path, bool half_close){
+    char req[96];
+    snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: picow\r\n\r\n", path);
+    http_fake_accept();
+    assert(http_fake_request(req) == ERR_OK);
+    if (half_close) {
+        assert(http_fake_fin() == ERR_OK);
+        assert(!http_fake_closed);
+    }
+    assert(http_fake_drain() > 10);
+}
+
+static void check(const char* path, bool half_close, size_t window){
+    get(path, half_close);
+    assert(strncmp(http_fake_out, "HTTP/1.1 200 OK", 15) == 0);
+    assert(http_fake_body(body, sizeof(body)) == BODY_LEN);
+    assert(memcmp(body, big, BODY_LEN) == 0);
+    assert(http_fake_max_unacked <= window);
+    // Kept open for the next request, or closed once the response is out
+    assert(half_close ? (http_fake_shut_tx || http_fake_closed) : !(http_fake_shut_tx || http_fake_closed));
+}
+
+int main(void){
+    for (size_t i = 0; i < BODY_LEN; i++) big[i] = 'a' + (i * 7) % 26;
+    add_http_static_route("/flash", "text/plain", big, BODY_LEN);
+    add_http_generator_route("/generated", "text/plain", BODY_LEN, generate, NULL);
+    add_http_chunked_route("/chunked", "text/plain", produce, NULL);
+    add_http_writer_route("/writer", writer);
+
+    // The head goes out with the first window of a streamed body
+    size_t window = HTTP_STREAM_COPY_WINDOW + 256;
+    for (int half_close = 0; half_close < 2; half_close++) {
+        check("/flash", half_close, window);
+        check("/generated", half_close, window);
+        check("/chunked", half_close, window);
+        check("/writer", half_close, TCP_SND_BUF);
+    }
+
+    // Half-closed with nothing in flight: closed right away
+    http_fake_accept();
+    assert(http_fake_fin() == ERR_OK);
+    assert(http_fake_closed);
+
+    printf("http_stream_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Host test for response writers: small responses get a Content-Length,
+// large ones go out chunked as the send buffer drains, a response finished
+// after its handler returned holds back the requests behind it, references
+// go stale once the response ends or the connection drops, and a response
+// that lwIP accepts only in part closes the connection instead of being
+// sent again from the start. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/http_writer_test.c tests/host/http_fake.c src/http.c
+//       src/http_parser.c src/http_router.c src/http_query.c
+//       picow_websockets/ws_pool.c -o http_writer_test && ./http_writer_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "http.h"
+#include "http_fake.h"
+
+#define BIG_LEN 3000
+
+static char big[BIG_LEN];
+static size_t big_sent;
+
+static void big_drain(http_writer_t* w, void* arg){
+    if (!w) return;
+    big_sent += http_write(w, big + big_sent, BIG_LEN - big_sent);
+    if (big_sent == BIG_LEN) http_end(w);
+}
+
+static void big_page(http_writer_t* w, const http_route_params_t* params, char* query){
+    big_sent = 0;
+    http_writer_header(w, "Content-Type", "text/plain");
+    http_writer_on_drain(w, big_drain, NULL);
+    big_drain(w, NULL);
+}
+
+static void small_page(http_writer_t* w, const http_route_params_t* params, char* query){
+    http_printf(w, "hello %s", "world");
+    http_end(w);
+}
+
+static void status_page(http_writer_t* w, const http_route_params_t* params, char* query){
+    http_writer_status(w, "404 Not Found");
+    http_writer_header(w, "X-Test", "1");
+    assert(http_write_static(w, "flash", 5));
+    http_end(w);
+}
+
+// Finished later, from outside the handler, through a reference
+static http_writer_ref_t later_ref;
+static int later_lost;
+
+static void later_drain(http_writer_t* w, void* arg){
+    if (!w) later_lost++;
+}
+
+static void later_page(http_writer_t* w, const http_route_params_t* params, char* query){
+    later_ref = http_writer_ref(w);
+    http_writer_on_drain(w, later_drain, NULL);
+}
+
+static int count(const char* haystack, const char* needle){
+    int n = 0;
+    for (const char* at = haystack; (at = strstr(at, needle)); at++) n++;
+    return n;
+}
+
+int main(void){
+    for (size_t i = 0; i < BIG_LEN; i++) big[i] = 'a' + i % 26;
+    add_http_writer_route("/small", small_page);
+    add_http_writer_route("/big", big_page);
+    add_http_writer_route("/status", status_page);
+    add_http_writer_route("/later", later_page);
+    static char body[2 * BIG_LEN];
+
+    // Fits the staging buffer: one response with a Content-Length
+    http_fake_accept();
+    assert(http_fake_request("GET /small HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    assert(strstr(http_fake_out, "Content-Length: 11\r\n"));
+    assert(strstr(http_fake_out, "\r\n\r\nhello world"));
+    assert(!http_fake_closed && !http_fake_shut_tx);
+
+    // Larger: chunked, completed from tcp_sent, then the connection is reused
+    http_fake_clear();
+    assert(http_fake_request("GET /big HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    http_fake_drain();
+    assert(strstr(http_fake_out, "Transfer-Encoding: chunked\r\n"));
+    assert(http_fake_body(body, sizeof(body)) == BIG_LEN && memcmp(body, big, BIG_LEN) == 0);
+    assert(!http_fake_closed && !http_fake_shut_tx);
+
+    // HTTP/1.0 knows no chunks: the body ends with the connection
+    http_fake_accept();
+    assert(http_fake_request("GET /big HTTP/1.0\r\n\r\n") == ERR_OK);
+    http_fake_drain();
+    assert(strstr(http_fake_out, "Connection: close\r\n"));
+    assert(http_fake_body(body, sizeof(body)) == BIG_LEN && memcmp(body, big, BIG_LEN) == 0);
+    assert(http_fake_shut_tx);
+
+    // Status, headers and the defaults for those not given; a body written
+    // from flash skips the staging buffer, so it goes out as a chunk
+    http_fake_accept();
+    assert(http_fake_request("GET /status HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    assert(strncmp(http_fake_out, "HTTP/1.1 404 Not Found\r\n", 24) == 0);
+    assert(strstr(http_fake_out, "X-Test: 1\r\n"));
+    assert(strstr(http_fake_out, "Content-Type: text/html"));
+    assert(strstr(http_fake_out, "Cache-Control: no-cache, no-store"));
+    assert(strstr(http_fake_out, "Transfer-Encoding: chunked\r\n"));
+    assert(http_fake_body(body, sizeof(body)) == 5 && memcmp(body, "flash", 5) == 0);
+
+    // Finished after the handler returned: the pipelined request waits for
+    // it, and the reference goes stale once the response is out
+    http_fake_accept();
+    assert(http_fake_request("GET /later HTTP/1.1\r\nHost: picow\r\n\r\n"
+                             "GET /small HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    assert(!strstr(http_fake_out, "hello world"));
+    http_writer_t* later = http_writer_get(later_ref);
+    assert(later);
+    http_printf(later, "later");
+    http_end(later);
+    assert(!http_writer_get(later_ref));
+    http_fake_drain();
+    const char* second = strstr(http_fake_out, "later");
+    assert(second && strstr(second, "HTTP/1.1 200 OK") && strstr(second, "\r\n\r\nhello world"));
+    assert(later_lost == 0);
+
+    // The connection drops first: the drain callback hears of it once, and
+    // the reference is stale even though the writer is reused right away
+    http_fake_accept();
+    assert(http_fake_request("GET /later HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    http_writer_ref_t lost_ref = later_ref;
+    assert(http_writer_get(lost_ref));
+    http_fake_accept();
+    assert(later_lost == 1);
+    assert(!http_writer_get(lost_ref));
+    assert(http_fake_request("GET /later HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    assert(http_writer_get(later_ref) && !http_writer_get(lost_ref));
+    http_end(http_writer_get(later_ref));
+
+    // No room for the head at all: nothing is queued, and it goes out once
+    // the send buffer drains
+    http_fake_accept();
+    http_fake_writes_left = 0;
+    assert(http_fake_request("GET /big HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    assert(http_fake_out_len == 0);
+    http_fake_writes_left = -1;
+    assert(http_fake_poll() == ERR_OK);
+    http_fake_drain();
+    assert(count(http_fake_out, "HTTP/1.1 200 OK") == 1);
+    assert(http_fake_body(body, sizeof(body)) == BIG_LEN && memcmp(body, big, BIG_LEN) == 0);
+    assert(!http_fake_closed && !http_fake_shut_tx);
+
+    // The status line queued, the rest of the head refused: the response
+    // cannot be completed, so the connection is closed rather than the
+    // status line sent twice
+    http_fake_accept();
+    http_fake_writes_left = 1;
+    assert(http_fake_request("GET /big HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    http_fake_writes_left = -1;
+    http_fake_drain();
+    assert(count(http_fake_out, "HTTP/1.1 200 OK") == 1);
+    assert(http_fake_shut_tx || http_fake_closed);
+
+    // The same part way through a chunk, from tcp_sent: the send buffer
+    // only takes the head at first
+    http_fake_accept();
+    http_fake_pcb.snd_buf = 256;
+    assert(http_fake_request("GET /big HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    size_t before = http_fake_out_len;
+    http_fake_writes_left = 1;
+    http_fake_ack();
+    http_fake_writes_left = -1;
+    http_fake_drain();
+    assert(http_fake_out_len > before);
+    assert(http_fake_body(body, sizeof(body)) == -1);
+    assert(http_fake_shut_tx || http_fake_closed);
+
+    // Writers are not leaked by the failures
+    http_fake_accept();
+    assert(http_fake_request("GET /small HTTP/1.1\r\nHost: picow\r\n\r\n") == ERR_OK);
+    assert(strstr(http_fake_out, "\r\n\r\nhello world"));
+
+    printf("http_writer_test: ok\n");
+    return 0;
+}
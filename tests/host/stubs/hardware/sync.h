@@ -0,0 +1,7 @@
+#pragma once
+#include <sched.h>
+#include "pico/stdlib.h"
+
+static inline void __dmb(void){ __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+static inline void __sev(void){}
+static inline void __wfe(void){ sched_yield(); }
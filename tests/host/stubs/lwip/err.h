@@ -0,0 +1,9 @@
+#pragma once
+typedef signed char err_t;
+#define ERR_OK    0
+#define ERR_MEM  -1
+#define ERR_VAL  -6
+#define ERR_ABRT -13
+#define ERR_RST  -14
+#define ERR_CLSD -15
+#define ERR_ARG  -16
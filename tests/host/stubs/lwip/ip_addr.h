@@ -0,0 +1,6 @@
+#pragma once
+#include "lwip/arch.h"
+typedef struct { u32_t addr; } ip_addr_t;
+extern const ip_addr_t ip_addr_any;
+#define IP_ADDR_ANY (&ip_addr_any)
+char *ipaddr_ntoa_r(const ip_addr_t *addr, char *buf, int buflen);
@@ -0,0 +1,11 @@
+#pragma once
+#include "lwip/arch.h"
+#include "lwip/err.h"
+struct pbuf { struct pbuf* next; void* payload; u16_t tot_len; u16_t len; };
+u8_t pbuf_free(struct pbuf *p);
+struct pbuf *pbuf_skip(struct pbuf *in, u16_t in_offset, u16_t *out_offset);
+u8_t pbuf_get_at(const struct pbuf *p, u16_t offset);
+u16_t pbuf_copy_partial(const struct pbuf *p, void *dataptr, u16_t len, u16_t offset);
+typedef enum { PBUF_TRANSPORT, PBUF_IP, PBUF_LINK, PBUF_RAW_TX, PBUF_RAW } pbuf_layer;
+typedef enum { PBUF_RAM, PBUF_ROM, PBUF_REF, PBUF_POOL } pbuf_type;
+struct pbuf *pbuf_clone(pbuf_layer l, pbuf_type type, struct pbuf *p);
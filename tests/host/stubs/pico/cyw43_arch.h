@@ -0,0 +1,23 @@
+#pragma once
+#include "pico/stdlib.h"
+#include "lwip/tcp.h"
+
+typedef struct async_context async_context_t;
+typedef struct async_when_pending_worker {
+    void (*do_work)(async_context_t* context, struct async_when_pending_worker* worker);
+    void* user_data;
+} async_when_pending_worker_t;
+typedef struct async_at_time_worker {
+    void (*do_work)(async_context_t* context, struct async_at_time_worker* worker);
+    void* user_data;
+} async_at_time_worker_t;
+
+async_context_t* cyw43_arch_async_context(void);
+bool async_context_add_when_pending_worker(async_context_t* context, async_when_pending_worker_t* worker);
+void async_context_set_work_pending(async_context_t* context, async_when_pending_worker_t* worker);
+bool async_context_add_at_time_worker_in_ms(async_context_t* context, async_at_time_worker_t* worker, uint32_t ms);
+
+void cyw43_arch_lwip_begin(void);
+void cyw43_arch_lwip_end(void);
+void cyw43_arch_poll(void);
+void cyw43_arch_wait_for_work_until(absolute_time_t until);
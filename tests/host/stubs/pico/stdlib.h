@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+// Time: the clock itself is up to each test
+typedef uint64_t absolute_time_t;
+#define at_the_end_of_time ((absolute_time_t)INT64_MAX)
+absolute_time_t get_absolute_time(void);
+void sleep_ms(uint32_t ms);
+static inline uint64_t to_us_since_boot(absolute_time_t t){ return t; }
+static inline absolute_time_t from_us_since_boot(uint64_t us){ return us; }
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to){ return (int64_t)(to - from); }
+static inline bool time_reached(absolute_time_t t){ return get_absolute_time() >= t; }
+
+unsigned get_core_num(void);
@@ -0,0 +1,124 @@
+// Host test for the WebSocket client table: clients reset by the peer or
+// closed for an oversized frame give their slot back, broadcasts never
+// reach a pcb lwIP has freed, and inline text handlers get the unmasked
+// payload while truncated frames are dropped. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/ws_client_test.c picow_websockets/websocket.c
+//       picow_websockets/packet_ops.c picow_websockets/ws_pool.c
+//       -o ws_client_test && ./ws_client_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "websocket.h"
+#include "ws_governor.h"
+#include "ws_dispatch.h"
+
+// lwIP: one pcb per client, the callbacks lwIP would call recorded per pcb
+#define CLIENTS (WS_MAX_CLIENTS * 2 + 1)
+
+static struct tcp_pcb clients[CLIENTS];
+static tcp_err_fn err_fns[CLIENTS];
+static tcp_recv_fn recv_fn;
+static bool freed[CLIENTS];
+static bool rejected[CLIENTS];
+static int writes[CLIENTS];
+
+static int client_index(struct tcp_pcb* pcb){ return (int)(pcb - clients); }
+
+void tcp_arg(struct tcp_pcb* pcb, void* arg){ pcb->callback_arg = arg; }
+void tcp_err(struct tcp_pcb* pcb, tcp_err_fn err){ err_fns[client_index(pcb)] = err; }
+void tcp_recv(struct tcp_pcb* pcb, tcp_recv_fn recv){ if (recv) recv_fn = recv; }
+void tcp_poll(struct tcp_pcb* pcb, tcp_poll_fn poll, u8_t interval){}
+void tcp_recved(struct tcp_pcb* pcb, u16_t len){}
+err_t tcp_output(struct tcp_pcb* pcb){ return ERR_OK; }
+void tcp_abort(struct tcp_pcb* pcb){ freed[client_index(pcb)] = true; }
+err_t tcp_close(struct tcp_pcb* pcb){ freed[client_index(pcb)] = true; return ERR_OK; }
+err_t tcp_write(struct tcp_pcb* pcb, const void* data, u16_t len, u8_t flags){
+    assert(!freed[client_index(pcb)]);
+    writes[client_index(pcb)]++;
+    return ERR_OK;
+}
+u8_t pbuf_free(struct pbuf* p){ return 1; }
+u8_t pbuf_get_at(const struct pbuf* p, u16_t offset){ return ((u8_t*)p->payload)[offset]; }
+u16_t pbuf_copy_partial(const struct pbuf* p, void* data, u16_t len, u16_t offset){
+    memcpy(data, (u8_t*)p->payload + offset, len);
+    return len;
+}
+char* ipaddr_ntoa_r(const ip_addr_t* addr, char* buf, int buflen){ return buf; }
+void cyw43_arch_lwip_begin(void){}
+void cyw43_arch_lwip_end(void){}
+
+// Governor, dispatch and state store: plenty of memory, inline dispatch
+bool ws_governor_admit(void){ return true; }
+err_t ws_governor_reject(struct tcp_pcb* pcb){ rejected[client_index(pcb)] = true; return ERR_OK; }
+uint16_t ws_governor_recv_credit(uint16_t* withheld, uint16_t len){ return len; }
+WS_DISPATCH_MODE ws_get_dispatch_mode(void){ return WS_DISPATCH_INLINE; }
+err_t ws_dispatch_receive(struct tcp_pcb* pcb, struct pbuf* p){ return ERR_OK; }
+void ws_state_send_snapshots(ws_client_tpcb wc, const char* route){}
+
+static uint8_t* text_msg;
+static size_t text_len;
+static int texts;
+
+static void on_text(ws_client_tpcb wc, uint8_t* msg, size_t len){
+    text_msg = msg;
+    text_len = len;
+    texts++;
+}
+
+static err_t deliver(int i, uint8_t* frame, size_t len){
+    struct pbuf p = {.payload = frame, .len = len, .tot_len = len};
+    return recv_fn(clients[i].callback_arg, &clients[i], &p, ERR_OK);
+}
+
+static bool upgrade(int i){
+    char req[] = "GET /chat HTTP/1.1\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n\r\n";
+    struct pbuf p = {.payload = req, .len = sizeof(req) - 1, .tot_len = sizeof(req) - 1};
+    clients[i] = (struct tcp_pcb){.state = ESTABLISHED};
+    assert(websocket_schema_upgrade(req, &clients[i], &p) == ERR_OK);
+    return !rejected[i];
+}
+
+static void reset(int i){
+    freed[i] = true;
+    err_fns[i](clients[i].callback_arg, ERR_RST);
+}
+
+int main(void){
+    // Fill the table, then have every peer reset its connection
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        assert(upgrade(i));
+        assert(err_fns[i] != NULL);
+    }
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) reset(i);
+    assert(!ws_route_has_clients("/chat"));
+
+    // The slots are free again, and a broadcast only reaches live clients
+    for (int i = WS_MAX_CLIENTS; i < 2 * WS_MAX_CLIENTS; i++) assert(upgrade(i));
+    ws_send_to_all_clients("/chat", WS_OP_TEXT, (uint8_t*)"hi", 2);
+    for (int i = WS_MAX_CLIENTS; i < 2 * WS_MAX_CLIENTS; i++) assert(writes[i] == 2);   // 101 + message
+
+    // Text frames reach the handler unmasked
+    ws_add_on_text_handler(on_text);
+    int chat = WS_MAX_CLIENTS + 1;
+    uint8_t hello[] = {0x81, 0x85, 1, 2, 3, 4, 'h' ^ 1, 'e' ^ 2, 'l' ^ 3, 'l' ^ 4, 'o' ^ 1};
+    assert(deliver(chat, hello, sizeof(hello)) == ERR_OK);
+    assert(texts == 1 && text_len == 5 && memcmp(text_msg, "hello", 5) == 0);
+
+    // A frame shorter than its header says is dropped, the client kept
+    uint8_t truncated[] = {0x81, 0x0A, 'a', 'b'};
+    assert(deliver(chat, truncated, sizeof(truncated)) == ERR_OK);
+    assert(texts == 1 && !freed[chat]);
+
+    // A frame larger than the receive buffer closes the client and frees its slot
+    static uint8_t big[WS_BUFFER_SIZE + 16] = {0x81, 0xFE};
+    int victim = WS_MAX_CLIENTS;
+    assert(deliver(victim, big, sizeof(big)) == ERR_OK);
+    assert(freed[victim]);
+    assert(upgrade(2 * WS_MAX_CLIENTS));
+
+    printf("ws_client_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,121 @@
+// Messages per second through deferred dispatch with the handlers on the
+// receiving core versus on a second core (ws_core1). Threads stand in for
+// the RP2040 cores, so only the ratio between the two columns carries over
+// to the board. From the repository root:
+//
+//   gcc -O2 -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/ws_dispatch_bench.c picow_websockets/ws_dispatch.c
+//       picow_websockets/ws_core1.c picow_websockets/packet_ops.c
+//       -lpthread -o ws_dispatch_bench && ./ws_dispatch_bench
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "pico/cyw43_arch.h"
+#include "pico/multicore.h"
+#include "ws_dispatch.h"
+#include "ws_core1.h"
+
+#define MESSAGES    200000
+#define LWIP_ROUNDS 4   // framing and TCP work per message on core0
+
+// Cores: one thread each, get_core_num() tells them apart
+static __thread unsigned core_num = 0;
+
+unsigned get_core_num(void){ return core_num; }
+
+static void* core1_entry(void* entry){
+    core_num = 1;
+    ((void (*)(void))entry)();
+    return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void)){
+    pthread_t thread;
+    pthread_create(&thread, NULL, core1_entry, (void*)entry);
+}
+
+// lwIP: one client, pbufs never really freed, reclaim runs from receive
+async_context_t* cyw43_arch_async_context(void){ return NULL; }
+bool async_context_add_when_pending_worker(async_context_t* context, async_when_pending_worker_t* worker){ return true; }
+void async_context_set_work_pending(async_context_t* context, async_when_pending_worker_t* worker){}
+void cyw43_arch_lwip_begin(void){}
+void cyw43_arch_lwip_end(void){}
+u8_t pbuf_free(struct pbuf* p){ return 1; }
+struct pbuf* pbuf_clone(pbuf_layer l, pbuf_type type, struct pbuf* p){ return NULL; }
+ws_client_id_t ws_client_id(ws_client_tpcb wc){ return (ws_client_id_t){0}; }
+void ws_client_recved(ws_client_id_t id, uint16_t len){}
+
+// Synthetic work: FNV-1a over the message, `rounds` times
+static uint32_t work(const uint8_t* msg, size_t len, int rounds){
+    uint32_t h = 2166136261u;
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < len; i++) h = (h ^ msg[i]) * 16777619u;
+    }
+    return h;
+}
+
+static int handler_rounds;
+static volatile uint32_t handled;
+static volatile uint32_t sink;
+
+static void on_message(ws_client_id_t client, uint8_t* msg, size_t len){
+    sink = work(msg, len, handler_rounds);
+    __atomic_add_fetch(&handled, 1, __ATOMIC_RELEASE);
+}
+
+static uint8_t frame[2 + 64] = {0x81, 64};
+static struct pbuf p = {.payload = frame, .len = sizeof(frame), .tot_len = sizeof(frame)};
+
+static double now_s(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Feeds MESSAGES frames as lwIP would; with a single core the loop drains
+// the ring itself, as ws_loop_run_once() does
+static double run(bool single_core){
+    handled = 0;
+    double start = now_s();
+    for (int i = 0; i < MESSAGES; i++) {
+        sink = work(frame, sizeof(frame), LWIP_ROUNDS);
+        while (ws_dispatch_receive(NULL, &p) == ERR_MEM) {
+            if (single_core) ws_dispatch_drain(0);
+            else sched_yield();
+        }
+        if (single_core) ws_dispatch_drain(0);
+    }
+    while (__atomic_load_n(&handled, __ATOMIC_ACQUIRE) < MESSAGES) sched_yield();
+    return MESSAGES / (now_s() - start);
+}
+
+int main(void){
+    static const int rounds[] = {0, 4, 16, 64};
+    double one[count_of(rounds)], two[count_of(rounds)];
+    if (sysconf(_SC_NPROCESSORS_ONLN) < 2) {
+        printf("ws_dispatch_bench: one CPU online, the 2 core column is not meaningful\n");
+    }
+
+    ws_set_dispatch_mode(WS_DISPATCH_DEFERRED);
+    ws_set_dispatch_handler(on_message);
+    for (size_t i = 0; i < count_of(rounds); i++) {
+        handler_rounds = rounds[i];
+        one[i] = run(true);
+    }
+
+    ws_core1_worker_start(NULL);
+    for (size_t i = 0; i < count_of(rounds); i++) {
+        handler_rounds = rounds[i];
+        two[i] = run(false);
+    }
+
+    printf("%-14s %12s %12s %8s\n", "handler work", "1 core msg/s", "2 core msg/s", "speedup");
+    for (size_t i = 0; i < count_of(rounds); i++) {
+        printf("%2d x 64 B      %12.0f %12.0f %7.2fx\n", rounds[i], one[i], two[i], two[i] / one[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+// Host test for deferred dispatch: handlers get client ids that stop
+// resolving once the client is gone, even after its slot is reused, and the
+// window credit of handled messages goes through the governor, only to
+// clients that are still connected. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/ws_dispatch_test.c picow_websockets/websocket.c
+//       picow_websockets/ws_dispatch.c picow_websockets/packet_ops.c
+//       picow_websockets/ws_pool.c -o ws_dispatch_test && ./ws_dispatch_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "websocket.h"
+#include "ws_governor.h"
+#include "ws_dispatch.h"
+#include "pico/cyw43_arch.h"
+
+// lwIP: one pcb per client, the callbacks lwIP would call recorded per pcb
+static struct tcp_pcb clients[2];
+static tcp_err_fn err_fns[2];
+static tcp_recv_fn recv_fn;
+static int recved[2];
+static bool freed[2];
+
+static int client_index(struct tcp_pcb* pcb){ return (int)(pcb - clients); }
+
+void tcp_arg(struct tcp_pcb* pcb, void* arg){ pcb->callback_arg = arg; }
+void tcp_err(struct tcp_pcb* pcb, tcp_err_fn err){ err_fns[client_index(pcb)] = err; }
+void tcp_recv(struct tcp_pcb* pcb, tcp_recv_fn recv){ if (recv) recv_fn = recv; }
+void tcp_poll(struct tcp_pcb* pcb, tcp_poll_fn poll, u8_t interval){}
+void tcp_recved(struct tcp_pcb* pcb, u16_t len){
+    assert(!freed[client_index(pcb)]);
+    recved[client_index(pcb)] += len;
+}
+err_t tcp_output(struct tcp_pcb* pcb){ return ERR_OK; }
+void tcp_abort(struct tcp_pcb* pcb){ freed[client_index(pcb)] = true; }
+err_t tcp_close(struct tcp_pcb* pcb){ freed[client_index(pcb)] = true; return ERR_OK; }
+err_t tcp_write(struct tcp_pcb* pcb, const void* data, u16_t len, u8_t flags){ return ERR_OK; }
+u8_t pbuf_free(struct pbuf* p){ return 1; }
+struct pbuf* pbuf_clone(pbuf_layer l, pbuf_type type, struct pbuf* p){ return NULL; }
+u8_t pbuf_get_at(const struct pbuf* p, u16_t offset){ return ((u8_t*)p->payload)[offset]; }
+u16_t pbuf_copy_partial(const struct pbuf* p, void* data, u16_t len, u16_t offset){
+    memcpy(data, (u8_t*)p->payload + offset, len);
+    return len;
+}
+char* ipaddr_ntoa_r(const ip_addr_t* addr, char* buf, int buflen){ return buf; }
+
+// async_context: the reclaim worker runs when the test says so
+static async_when_pending_worker_t* reclaim_worker;
+static bool reclaim_pending;
+
+async_context_t* cyw43_arch_async_context(void){ return NULL; }
+bool async_context_add_when_pending_worker(async_context_t* context, async_when_pending_worker_t* worker){
+    reclaim_worker = worker;
+    return true;
+}
+void async_context_set_work_pending(async_context_t* context, async_when_pending_worker_t* worker){ reclaim_pending = true; }
+void cyw43_arch_lwip_begin(void){}
+void cyw43_arch_lwip_end(void){}
+unsigned get_core_num(void){ return 0; }
+
+static void run_reclaim(void){
+    assert(reclaim_pending);
+    reclaim_pending = false;
+    reclaim_worker->do_work(NULL, reclaim_worker);
+}
+
+// Governor withholds half of every credit; state store unused
+static int credit_calls;
+
+bool ws_governor_admit(void){ return true; }
+err_t ws_governor_reject(struct tcp_pcb* pcb){ return ERR_OK; }
+uint16_t ws_governor_recv_credit(uint16_t* withheld, uint16_t len){
+    credit_calls++;
+    *withheld += len - len / 2;
+    return len / 2;
+}
+void ws_state_send_snapshots(ws_client_tpcb wc, const char* route){}
+
+// Deferred handler: what it saw, resolved as it ran
+static ws_client_id_t seen_id;
+static ws_client_tpcb seen_tpcb;
+static char seen_msg[16];
+
+static void on_message(ws_client_id_t client, uint8_t* msg, size_t len){
+    seen_id = client;
+    seen_tpcb = ws_client_resolve(client);
+    snprintf(seen_msg, sizeof(seen_msg), "%.*s", (int)len, (char*)msg);
+}
+
+static void upgrade(int i){
+    char req[] = "GET /chat HTTP/1.1\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n\r\n";
+    struct pbuf p = {.payload = req, .len = sizeof(req) - 1, .tot_len = sizeof(req) - 1};
+    clients[i] = (struct tcp_pcb){.state = ESTABLISHED};
+    freed[i] = false;
+    assert(websocket_schema_upgrade(req, &clients[i], &p) == ERR_OK);
+}
+
+static void receive(int i, const char* text){
+    static uint8_t frames[2][32];
+    static int next;
+    uint8_t* frame = frames[next++ % 2];
+    size_t len = strlen(text);
+    frame[0] = 0x81;
+    frame[1] = (uint8_t)len;
+    memcpy(frame + 2, text, len);
+    struct pbuf p = {.payload = frame, .len = len + 2, .tot_len = len + 2};
+    assert(recv_fn(clients[i].callback_arg, &clients[i], &p, ERR_OK) == ERR_OK);
+}
+
+int main(void){
+    ws_set_dispatch_mode(WS_DISPATCH_DEFERRED);
+    ws_set_dispatch_handler(on_message);
+
+    // A live client: its id resolves in the handler, its credit is returned
+    // through the governor once the message is handled
+    upgrade(0);
+    receive(0, "hello");
+    assert(recved[0] == 0);
+    assert(ws_dispatch_drain(0) == 1);
+    assert(strcmp(seen_msg, "hello") == 0);
+    assert(seen_tpcb == &clients[0]);
+    run_reclaim();
+    assert(credit_calls == 1);
+    assert(recved[0] == 7 / 2);
+
+    // The sender resets and another client takes its slot before the
+    // message is handled: the old id resolves to nothing
+    receive(0, "stale");
+    ws_client_id_t old = ws_client_id(&clients[0]);
+    freed[0] = true;
+    err_fns[0](clients[0].callback_arg, ERR_RST);
+    upgrade(1);
+    assert(ws_client_id(&clients[1]).slot == old.slot);
+
+    assert(ws_dispatch_drain(0) == 1);
+    assert(strcmp(seen_msg, "stale") == 0);
+    assert(seen_tpcb == NULL);
+    char ip[16];
+    assert(ws_client_get_ip(seen_id, ip, sizeof(ip)) == NULL);
+    assert(ws_client_get_route(seen_id, ip, sizeof(ip)) == NULL);
+    run_reclaim();
+    assert(credit_calls == 1);
+    assert(recved[1] == 0);
+
+    // The new client's id does resolve
+    ws_client_id_t id = ws_client_id(&clients[1]);
+    assert(ws_client_resolve(id) == &clients[1]);
+    assert(ws_client_get_route(id, ip, sizeof(ip)) && strcmp(ip, "/chat") == 0);
+
+    printf("ws_dispatch_test: ok\n");
+    return 0;
+}
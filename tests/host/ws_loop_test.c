@@ -0,0 +1,134 @@
+// Host test for the application loop: ws_loop_run_once() sleeps until the
+// next timer or until network work arrives, instead of spinning, and a
+// message that wakes it is handled at that same moment rather than at the
+// next timer tick. The clock only moves when the loop sleeps, so every
+// iteration that did not sleep would show up as one more at the same time.
+// From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/ws_loop_test.c picow_websockets/ws_loop.c
+//       picow_websockets/ws_timer.c picow_websockets/ws_dispatch.c
+//       picow_websockets/packet_ops.c -o ws_loop_test && ./ws_loop_test
+
+#include <assert.h>
+#include <stdio.h>
+#include "pico/cyw43_arch.h"
+#include "ws_loop.h"
+#include "ws_timer.h"
+#include "ws_dispatch.h"
+
+#define MS 1000u
+
+// Clock: moved by the fake wait below only
+static absolute_time_t now_us = 5 * MS;
+
+absolute_time_t get_absolute_time(void){ return now_us; }
+
+// lwIP receives a text frame at `arrival` when `arriving`, while the loop sleeps
+static uint8_t frame[] = {0x81, 4, 'p', 'i', 'n', 'g'};
+static struct pbuf p = {.payload = frame, .len = sizeof(frame), .tot_len = sizeof(frame)};
+static absolute_time_t arrival;
+static bool arriving;
+static absolute_time_t last_deadline;
+static int polls;
+
+void cyw43_arch_poll(void){ polls++; }
+
+void cyw43_arch_wait_for_work_until(absolute_time_t until){
+    assert(until > now_us);
+    last_deadline = until;
+    if (arriving && arrival <= until) {
+        now_us = arrival;
+        arriving = false;
+        assert(ws_dispatch_receive(NULL, &p) == ERR_OK);
+    } else if (until != at_the_end_of_time) {
+        now_us = until;
+    }
+}
+
+// lwIP and the rest of the server, as far as dispatch needs them
+async_context_t* cyw43_arch_async_context(void){ return NULL; }
+bool async_context_add_when_pending_worker(async_context_t* context, async_when_pending_worker_t* worker){ return true; }
+void async_context_set_work_pending(async_context_t* context, async_when_pending_worker_t* worker){}
+void cyw43_arch_lwip_begin(void){}
+void cyw43_arch_lwip_end(void){}
+unsigned get_core_num(void){ return 0; }
+u8_t pbuf_free(struct pbuf* p){ return 1; }
+struct pbuf* pbuf_clone(pbuf_layer l, pbuf_type type, struct pbuf* p){ return NULL; }
+ws_client_id_t ws_client_id(ws_client_tpcb wc){ return (ws_client_id_t){0}; }
+void ws_client_recved(ws_client_id_t id, uint16_t len){}
+bool ws_core1_worker_running(void){ return false; }
+
+static int fired;
+static absolute_time_t fired_at[32];
+static int handled;
+static absolute_time_t handled_at;
+
+static void on_timer(ws_timer_t* timer, void* arg){
+    assert(fired < (int)count_of(fired_at));
+    fired_at[fired++] = now_us;
+}
+
+static void on_message(ws_client_id_t client, uint8_t* msg, size_t len){
+    handled++;
+    handled_at = now_us;
+}
+
+int main(void){
+    ws_set_dispatch_mode(WS_DISPATCH_DEFERRED);
+    ws_set_dispatch_handler(on_message);
+
+    ws_timer_t timer;
+    ws_timer_init(&timer, on_timer, NULL);
+    ws_timer_start(&timer, 100, 100);
+
+    // Ten expiries, each on time, one sleep per iteration, and only the
+    // extra wake-ups the wheel needs to cascade its upper levels
+    while (fired < 10) ws_loop_run_once(at_the_end_of_time);
+    ws_loop_stats_t stats;
+    ws_loop_get_stats(&stats);
+    for (int i = 0; i < fired; i++) {
+        assert(fired_at[i] - fired_at[0] == (absolute_time_t)i * 100 * MS);
+    }
+    assert(stats.sleeps == stats.iterations);
+    assert(stats.iterations <= 10 + 1000 / (WS_TIMER_SLOTS * WS_TIMER_TICK_MS) + 1);
+    assert(polls == (int)stats.iterations);
+
+    // The loop went back to sleep right after the last expiry, until the next
+    assert(now_us == last_deadline && now_us == fired_at[9] + 100 * MS);
+
+    // A message arriving between two expiries wakes the loop early and is
+    // handled on that iteration, which then sleeps until the timer again
+    absolute_time_t woken = arrival = now_us + 30 * MS;
+    arriving = true;
+    ws_loop_run_once(at_the_end_of_time);
+    assert(fired == 11 && handled == 0 && now_us == woken);
+    ws_loop_run_once(at_the_end_of_time);
+    assert(handled == 1 && handled_at == woken);
+    assert(now_us == fired_at[10] + 100 * MS);
+    ws_loop_get_stats(&stats);
+    assert(stats.messages == 1);
+
+    // An earlier caller deadline wins over the timer
+    uint32_t sleeps = stats.sleeps;
+    absolute_time_t soon = now_us + 5 * MS;
+    ws_loop_run_once(soon);
+    assert(now_us == soon && last_deadline == soon);
+
+    // A deadline already reached: one pass over the work, no sleep
+    ws_loop_run_once(now_us);
+    ws_loop_get_stats(&stats);
+    assert(stats.sleeps == sleeps + 1);
+
+    // Nothing armed: sleep until network work, however long that takes
+    ws_timer_cancel(&timer);
+    woken = arrival = now_us + 60000 * MS;
+    arriving = true;
+    ws_loop_run_once(at_the_end_of_time);
+    assert(last_deadline == at_the_end_of_time);
+    ws_loop_run_once(at_the_end_of_time);
+    assert(handled == 2 && handled_at == woken && now_us == woken);
+
+    printf("ws_loop_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,196 @@
+// Host test for state stores: registered stores are ticked from the timer
+// wheel and broadcast only what changed, under the lwIP lock like the
+// setters; a field that could not fit a frame by itself is refused when it
+// is set, and larger deltas are split over several frames that together
+// carry every field. From the repository root:
+//
+//   gcc -Itests/host/stubs -Iincludes -Iconfigs -Ipicow_websockets
+//       tests/host/ws_state_test.c picow_websockets/ws_state.c
+//       picow_websockets/cbor.c picow_websockets/ws_timer.c
+//       -o ws_state_test && ./ws_state_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "pico/cyw43_arch.h"
+#include "ws_state.h"
+#include "ws_timer.h"
+#include "cbor.h"
+
+// Clock, moved by the test
+static absolute_time_t now_us;
+
+absolute_time_t get_absolute_time(void){ return now_us; }
+
+static void advance_ms(uint32_t ms){
+    now_us += ms * 1000u;
+    ws_timer_run();
+}
+
+// lwIP lock: the store may only touch shared state while it is held
+static int lock_depth, locks;
+
+void cyw43_arch_lwip_begin(void){ lock_depth++; locks++; }
+void cyw43_arch_lwip_end(void){ assert(lock_depth > 0); lock_depth--; }
+
+// Frames: everything sent, as (client, payload) pairs; NULL for a broadcast
+#define MAX_FRAMES 32
+
+static uint8_t out_buf[WS_BUFFER_SIZE];
+static uint8_t frames[MAX_FRAMES][WS_BUFFER_SIZE];
+static size_t frame_len[MAX_FRAMES];
+static ws_client_tpcb frame_to[MAX_FRAMES];
+static size_t frame_count;
+static bool subscribed = true;
+static bool allowed = true;
+
+uint8_t* ws_frame_begin(size_t* capacity){
+    *capacity = WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX;
+    return out_buf + WS_FRAME_HEADER_MAX;
+}
+
+static void record(ws_client_tpcb wc, WS_OPCODE opcode, packet_length len){
+    assert(lock_depth > 0 && opcode == WS_OP_BIN);
+    assert(frame_count < MAX_FRAMES && len <= WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX);
+    memcpy(frames[frame_count], out_buf + WS_FRAME_HEADER_MAX, len);
+    frame_len[frame_count] = len;
+    frame_to[frame_count++] = wc;
+}
+
+void ws_frame_send(ws_client_tpcb wc, WS_OPCODE opcode, packet_length len){ record(wc, opcode, len); }
+void ws_frame_send_to_all_clients(const char* route, WS_OPCODE opcode, packet_length len){
+    assert(strcmp(route, "/status") == 0);
+    record(NULL, opcode, len);
+}
+bool ws_route_has_clients(const char* route){ assert(lock_depth > 0); return subscribed; }
+bool ws_governor_allow_broadcast(void){ assert(lock_depth > 0); return allowed; }
+
+// Decodes frame `i`, [version, {key: uint, ...}], into `keys`/`values`;
+// returns the number of fields
+static size_t decode(size_t i, uint32_t* version, const char** keys, size_t* key_lens, uint64_t* values){
+    cbor_reader_t r;
+    size_t count;
+    uint64_t v;
+    cbor_reader_init(&r, frames[i], frame_len[i]);
+    assert(cbor_get_array(&r, &count) && count == 2);
+    assert(cbor_get_uint(&r, &v));
+    *version = (uint32_t)v;
+    assert(cbor_get_map(&r, &count));
+    for (size_t k = 0; k < count; k++) {
+        assert(cbor_get_text(&r, &keys[k], &key_lens[k]));
+        assert(cbor_get_uint(&r, &values[k]));
+    }
+    assert(r.pos == r.len);
+    return count;
+}
+
+static uint64_t field(size_t i, const char* key){
+    const char* keys[WS_STATE_MAX_FIELDS];
+    size_t key_lens[WS_STATE_MAX_FIELDS];
+    uint64_t values[WS_STATE_MAX_FIELDS];
+    uint32_t version;
+    size_t n = decode(i, &version, keys, key_lens, values);
+    for (size_t k = 0; k < n; k++) {
+        if (key_lens[k] == strlen(key) && memcmp(keys[k], key, key_lens[k]) == 0) return values[k];
+    }
+    return UINT64_MAX;
+}
+
+static ws_state_t status, big;
+static char long_keys[WS_STATE_MAX_FIELDS][300];
+static char huge_key[WS_BUFFER_SIZE];
+
+int main(void){
+    ws_state_init(&status, "/status");
+
+    // Setters take the lock; the value held already is not a change
+    assert(ws_state_set_uint(&status, "uptime", 5));
+    assert(ws_state_set_uint(&status, "clients", 2));
+    assert(locks == 2 && lock_depth == 0);
+    uint32_t version = status.version;
+    assert(ws_state_set_uint(&status, "uptime", 5));
+    assert(status.version == version);
+
+    // The timer wheel ticks the store: one frame with both fields, then
+    // nothing until something changes
+    advance_ms(WS_STATE_TICK_MS - WS_TIMER_TICK_MS);
+    assert(frame_count == 0);
+    advance_ms(2 * WS_TIMER_TICK_MS);
+    assert(frame_count == 1 && !frame_to[0]);
+    assert(field(0, "uptime") == 5 && field(0, "clients") == 2);
+    advance_ms(WS_STATE_TICK_MS);
+    assert(frame_count == 1);
+
+    // Only the field that changed
+    assert(ws_state_set_uint(&status, "uptime", 6));
+    advance_ms(WS_STATE_TICK_MS);
+    assert(frame_count == 2 && field(1, "uptime") == 6 && field(1, "clients") == UINT64_MAX);
+
+    // Held back by the governor, sent whole at the first tick allowed
+    allowed = false;
+    assert(ws_state_set_uint(&status, "uptime", 7));
+    assert(ws_state_set_uint(&status, "clients", 3));
+    advance_ms(WS_STATE_TICK_MS);
+    assert(frame_count == 2);
+    allowed = true;
+    advance_ms(WS_STATE_TICK_MS);
+    assert(frame_count == 3 && field(2, "uptime") == 7 && field(2, "clients") == 3);
+
+    // A newly upgraded client gets everything, alone
+    ws_client_tpcb client = (ws_client_tpcb)&status;
+    cyw43_arch_lwip_begin();
+    ws_state_send_snapshots(client, "/status");
+    ws_state_send_snapshots(client, "/other");
+    cyw43_arch_lwip_end();
+    assert(frame_count == 4 && frame_to[3] == client);
+    assert(field(3, "uptime") == 7 && field(3, "clients") == 3);
+
+    // A key that could never fit a frame with its value is refused, and
+    // takes no field; the longest that fits is sent in a frame of its own
+    size_t fits = WS_BUFFER_SIZE - WS_FRAME_HEADER_MAX - (1 + 5 + 1) - 3 - 1;
+    memset(huge_key, 'k', fits + 1);
+    assert(!ws_state_set_uint(&status, huge_key, 1));
+    assert(status.count == 2);
+    huge_key[fits] = '\0';
+    assert(ws_state_set_uint(&status, huge_key, 1));
+    assert(status.count == 3);
+    advance_ms(WS_STATE_TICK_MS);
+    assert(frame_count == 5 && field(4, huge_key) == 1);
+    assert(status.sent_version == status.version);
+
+    // Changes larger than a frame: several frames, same version, every
+    // field in exactly one of them
+    ws_state_init(&big, "/status");
+    frame_count = 0;
+    for (size_t i = 0; i < WS_STATE_MAX_FIELDS; i++) {
+        memset(long_keys[i], 'a' + i, sizeof(long_keys[i]) - 1);
+        assert(ws_state_set_uint(&big, long_keys[i], i));
+    }
+    advance_ms(WS_STATE_TICK_MS);
+    size_t seen = 0;
+    assert(frame_count > 1);
+    for (size_t f = 0; f < frame_count; f++) {
+        const char* keys[WS_STATE_MAX_FIELDS];
+        size_t key_lens[WS_STATE_MAX_FIELDS];
+        uint64_t values[WS_STATE_MAX_FIELDS];
+        uint32_t frame_version;
+        size_t n = decode(f, &frame_version, keys, key_lens, values);
+        assert(n > 0 && frame_version == big.version);
+        for (size_t k = 0; k < n; k++) {
+            assert(key_lens[k] == sizeof(long_keys[0]) - 1 && keys[k][0] == 'a' + (char)values[k]);
+            seen |= 1u << values[k];
+        }
+    }
+    assert(seen == (1u << WS_STATE_MAX_FIELDS) - 1);
+
+    // Nobody subscribed: nothing sent, and nothing left pending either
+    subscribed = false;
+    assert(ws_state_set_uint(&big, long_keys[0], 100));
+    size_t before = frame_count;
+    advance_ms(WS_STATE_TICK_MS);
+    assert(frame_count == before && big.sent_version == big.version);
+    assert(lock_depth == 0);
+
+    printf("ws_state_test: ok\n");
+    return 0;
+}